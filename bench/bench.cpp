@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <iomanip>
+
+namespace bench {
+
+// Output.
+// ----------------------------------------------------------------------------
+// Derived rates are included so that results can be compared across runs
+// with differing iteration counts. Names contain no quotes or delimiters.
+
+static double per_iteration(const result& result) NOEXCEPT
+{
+    return is_zero(result.iterations) ? 0.0 :
+        static_cast<double>(result.nanoseconds) / result.iterations;
+}
+
+static double per_item(const result& result) NOEXCEPT
+{
+    return is_zero(result.items) ? 0.0 :
+        per_iteration(result) / result.items;
+}
+
+static double items_per_second(const result& result) NOEXCEPT
+{
+    const auto nanoseconds = per_item(result);
+    return is_zero(nanoseconds) ? 0.0 : std::nano::den / nanoseconds;
+}
+
+static const char* boolean(bool value) NOEXCEPT
+{
+    return value ? "true" : "false";
+}
+
+void write_json(std::ostream& out, const results& results) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out << std::fixed << std::setprecision(3) << "{" << std::endl
+        << "  \"library\": \"" << LIBBITCOIN_SYSTEM_VERSION << "\"," << std::endl
+        << "  \"vector\": { "
+        << "\"sse41\": " << boolean(have_128) << ", "
+        << "\"avx2\": " << boolean(have_256) << ", "
+        << "\"avx512\": " << boolean(have_512) << ", "
+        << "\"sha\": " << boolean(have_sha) << ", "
+        << "\"aes\": " << boolean(have_aes) << " }," << std::endl
+        << "  \"results\": [";
+
+    auto first = true;
+    for (const auto& result: results)
+    {
+        out << (first ? "" : ",") << std::endl
+            << "    { "
+            << "\"suite\": \"" << result.suite << "\", "
+            << "\"name\": \"" << result.name << "\", "
+            << "\"iterations\": " << result.iterations << ", "
+            << "\"items\": " << result.items << ", "
+            << "\"failures\": " << result.failures << ", "
+            << "\"ns_total\": " << result.nanoseconds << ", "
+            << "\"ns_per_iteration\": " << per_iteration(result) << ", "
+            << "\"ns_per_item\": " << per_item(result) << ", "
+            << "\"items_per_second\": " << items_per_second(result) << " }";
+
+        first = false;
+    }
+
+    out << std::endl << "  ]" << std::endl << "}" << std::endl;
+    BC_POP_WARNING()
+}
+
+void write_csv(std::ostream& out, const results& results) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out << std::fixed << std::setprecision(3)
+        << "suite,name,iterations,items,failures,ns_total,"
+        << "ns_per_iteration,ns_per_item,items_per_second" << std::endl;
+
+    for (const auto& result: results)
+    {
+        out << result.suite << ","
+            << result.name << ","
+            << result.iterations << ","
+            << result.items << ","
+            << result.failures << ","
+            << result.nanoseconds << ","
+            << per_iteration(result) << ","
+            << per_item(result) << ","
+            << items_per_second(result) << std::endl;
+    }
+    BC_POP_WARNING()
+}
+
+// Fixtures.
+// ----------------------------------------------------------------------------
+// Each value is derived from its seed so that runs are reproducible.
+
+data_chunk get_data(size_t size, size_t seed) NOEXCEPT
+{
+    // Knuth's MMIX linear congruential generator, taking the high byte since
+    // low bits of the state have short periods (distinct seeds must differ).
+    constexpr uint64_t multiplier = 6364136223846793005;
+    constexpr uint64_t increment = 1442695040888963407;
+    constexpr auto shift = sub1(sizeof(uint64_t)) * byte_bits;
+
+    uint64_t state{ seed };
+    data_chunk out(size);
+    for (auto& byte: out)
+    {
+        state = state * multiplier + increment;
+        byte = narrow_cast<uint8_t>(state >> shift);
+    }
+
+    return out;
+}
+
+hash_digest get_hash(size_t seed) NOEXCEPT
+{
+    return sha256_hash(get_data(sizeof(uint64_t), seed));
+}
+
+ec_secret get_secret(size_t seed) NOEXCEPT
+{
+    // Hash output is a valid secret with overwhelming probability.
+    return get_hash(add1(seed));
+}
+
+} // namespace bench
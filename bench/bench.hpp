@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_BENCH_BENCH_HPP
+#define LIBBITCOIN_SYSTEM_BENCH_BENCH_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+#ifdef HAVE_MSC
+    BC_DISABLE_WARNING(NO_ARRAY_INDEXING)
+    BC_DISABLE_WARNING(NO_GLOBAL_INIT_CALLS)
+    BC_DISABLE_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+#endif
+
+namespace bench {
+
+using namespace bc;
+using namespace bc::system;
+
+/// Timing of one case, over all of its iterations.
+struct result
+{
+    std::string suite;
+    std::string name;
+
+    /// Iterations of the case, each processing items (txs, sigs, bytes).
+    size_t iterations;
+    size_t items;
+
+    /// Total elapsed time and count of iterations that returned false.
+    uint64_t nanoseconds;
+    size_t failures;
+};
+
+typedef std::vector<result> results;
+
+/// Runs and times cases, skipping those with "suite.name" not containing
+/// filter. Each iteration returns false to indicate an incorrect result,
+/// which is counted (a benchmark of a failing path is not meaningful).
+class runner
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    runner(size_t iterations, std::string filter) NOEXCEPT
+      : iterations_(iterations), filter_(std::move(filter))
+    {
+    }
+
+    /// Iterations is the default unless overridden by configuration.
+    template <typename Function>
+    void run(const std::string& suite, const std::string& name,
+        size_t iterations, size_t items, Function&& function) NOEXCEPT
+    {
+        if (!is_enabled(suite, name))
+            return;
+
+        if (!is_zero(iterations_))
+            iterations = iterations_;
+
+        size_t failures{};
+        const auto start = clock::now();
+        for (size_t iteration{}; iteration < iterations; ++iteration)
+            if (!function())
+                ++failures;
+
+        const auto elapsed = std::chrono::duration_cast<
+            std::chrono::nanoseconds>(clock::now() - start).count();
+
+        results_.push_back(
+        {
+            suite,
+            name,
+            iterations,
+            items,
+            possible_narrow_sign_cast<uint64_t>(elapsed),
+            failures
+        });
+    }
+
+    const results& get() const NOEXCEPT
+    {
+        return results_;
+    }
+
+private:
+    bool is_enabled(const std::string& suite,
+        const std::string& name) const NOEXCEPT
+    {
+        return filter_.empty() || contains(suite + "." + name, filter_);
+    }
+
+    static bool contains(const std::string& text,
+        const std::string& part) NOEXCEPT
+    {
+        return text.find(part) != std::string::npos;
+    }
+
+    const size_t iterations_;
+    const std::string filter_;
+    results results_{};
+};
+
+/// Output.
+void write_json(std::ostream& out, const results& results) NOEXCEPT;
+void write_csv(std::ostream& out, const results& results) NOEXCEPT;
+
+/// Deterministic pseudo-random fixture data.
+data_chunk get_data(size_t size, size_t seed) NOEXCEPT;
+hash_digest get_hash(size_t seed) NOEXCEPT;
+ec_secret get_secret(size_t seed) NOEXCEPT;
+
+/// Suites.
+void chain(runner& runner) NOEXCEPT;
+void crypto(runner& runner) NOEXCEPT;
+void filter(runner& runner) NOEXCEPT;
+void hash(runner& runner) NOEXCEPT;
+void radix(runner& runner) NOEXCEPT;
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,393 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+namespace bench {
+
+using namespace system::chain;
+
+constexpr auto suite = "chain";
+constexpr size_t transactions_count = 500;
+constexpr size_t inputs_per_transaction = 2;
+constexpr uint64_t prevout_value = 100'000;
+
+constexpr auto rules =
+    flags::bip16_rule |
+    flags::bip34_activations |
+    flags::bip9_bit0_group |
+    flags::bip9_bit1_group |
+    flags::bip9_bit2_group;
+
+// Fixture.
+// ----------------------------------------------------------------------------
+// A block of signed p2wpkh spends, with prevouts populated for connect. The
+// endorsement is created over the unwitnessed tx (witness is not committed).
+
+static transaction make_transaction(size_t seed) NOEXCEPT
+{
+    ec_compresseds keys(inputs_per_transaction);
+    std_vector<ec_secret> secrets(inputs_per_transaction);
+    inputs unsigned_inputs{};
+    outputs outs{};
+
+    for (size_t index{}; index < inputs_per_transaction; ++index)
+    {
+        const auto offset = seed * inputs_per_transaction + index;
+        secrets[index] = get_secret(offset);
+        secret_to_public(keys[index], secrets[index]);
+        unsigned_inputs.emplace_back(point{ get_hash(offset),
+            possible_narrow_cast<uint32_t>(index) }, script{}, max_uint32);
+        outs.emplace_back(prevout_value - 1'000, script
+        {
+            script::to_pay_witness_key_hash_pattern(
+                bitcoin_short_hash(get_data(ec_compressed_size, offset)))
+        });
+    }
+
+    const transaction unsigned_tx{ 2, unsigned_inputs, outs, 0 };
+
+    inputs signed_inputs{};
+    for (size_t index{}; index < inputs_per_transaction; ++index)
+    {
+        const auto hash = bitcoin_short_hash(keys[index]);
+        const script subscript{ script::to_pay_key_hash_pattern(hash) };
+        endorsement endorse{};
+        unsigned_tx.create_endorsement(endorse, secrets[index], subscript,
+            possible_narrow_cast<uint32_t>(index), prevout_value,
+            coverage::hash_all, script_version::segwit, rules);
+
+        const auto& in = *unsigned_tx.inputs_ptr()->at(index);
+        signed_inputs.emplace_back(in.point(), script{}, witness
+        {
+            data_stack{ endorse, to_chunk(keys[index]) }
+        }, in.sequence());
+    }
+
+    return { 2, signed_inputs, outs, 0 };
+}
+
+static void populate(const transaction& tx, size_t seed) NOEXCEPT
+{
+    for (size_t index{}; index < inputs_per_transaction; ++index)
+    {
+        const auto& in = *tx.inputs_ptr()->at(index);
+        const auto offset = seed * inputs_per_transaction + index;
+        ec_compressed key{};
+        secret_to_public(key, get_secret(offset));
+        in.prevout = to_shared<output>(prevout_value, script
+        {
+            script::to_pay_witness_key_hash_pattern(bitcoin_short_hash(key))
+        });
+    }
+}
+
+static block make_block() NOEXCEPT
+{
+    transactions txs{};
+    txs.reserve(transactions_count);
+    for (size_t seed{}; seed < transactions_count; ++seed)
+    {
+        txs.push_back(make_transaction(seed));
+        populate(txs.back(), seed);
+    }
+
+    return { header{ 4, get_hash(0), get_hash(1), 0, 0, 0 }, std::move(txs) };
+}
+
+// The fixture preceded by a coinbase committing to height 1'000'000 [bip34],
+// so that all check rules are evaluated. The merkle root is not committed.
+static data_chunk make_checked_block(const block& fixture) NOEXCEPT
+{
+    transactions txs{};
+    txs.reserve(add1(fixture.transactions_ptr()->size()));
+    txs.push_back(
+    {
+        1,
+        { { point{}, script{ base16_chunk("0340420f"), false }, max_uint32 } },
+        { { 0, script{} } },
+        0
+    });
+
+    for (const auto& tx: *fixture.transactions_ptr())
+        txs.push_back(*tx);
+
+    return block{ fixture.header(), std::move(txs) }.to_data(true);
+}
+
+// A block of at least the given size, of fixture transactions.
+static data_chunk make_sized_block(const block& fixture, size_t size) NOEXCEPT
+{
+    const auto& fixture_txs = *fixture.transactions_ptr();
+    const auto copies = add1(size / fixture.serialized_size(true));
+
+    transactions txs{};
+    txs.reserve(copies * fixture_txs.size());
+    for (size_t copy{}; copy < copies; ++copy)
+        for (const auto& tx: fixture_txs)
+            txs.push_back(*tx);
+
+    return block{ fixture.header(), std::move(txs) }.to_data(true);
+}
+
+template <typename Stack, bool Threaded = have_threaded_dispatch>
+static void connect_inputs(runner& runner, const std::string& name,
+    const transaction_cptrs& txs, const context& ctx,
+    size_t inputs_count) NOEXCEPT
+{
+    using program = machine::program<Stack>;
+    using interpreter = machine::interpreter<Stack, program, Threaded>;
+    runner.run(suite, name, 10, inputs_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        for (const auto& tx: txs)
+            for (auto it = tx->inputs_ptr()->begin();
+                it != tx->inputs_ptr()->end(); ++it)
+                success &= !interpreter::connect(ctx, *tx, it, {});
+
+        return success;
+    });
+}
+
+template <typename Source>
+static bool parse_views(Source& source, const data_chunk& data) NOEXCEPT
+{
+    source.skip_bytes(header::serialized_size());
+    const auto count = source.read_size(max_count);
+
+    auto valid{ true };
+    for (size_t tx{}; tx < count; ++tx)
+        valid &= transaction_view{ source, data, is_zero(tx), true, false }
+            .is_valid();
+
+    return valid && source;
+}
+
+// Cases.
+// ----------------------------------------------------------------------------
+
+void chain(runner& runner) NOEXCEPT
+{
+    const auto fixture = make_block();
+    const auto data = fixture.to_data(true);
+    const auto& txs = *fixture.transactions_ptr();
+    const auto inputs_count = transactions_count * inputs_per_transaction;
+    const context ctx{ rules, 0, 0, 1'000'000, 0, 0, 0 };
+
+    runner.run(suite, "block.deserialize", 100, transactions_count, [&]() NOEXCEPT
+    {
+        return block{ data, true }.is_valid();
+    });
+
+    // Default heap and arena deserialization of a mainnet-sized block. The
+    // arena is reset in one call, after the block (and its deleters) is gone.
+    const auto mainnet = make_sized_block(fixture, 1'000'000);
+    const auto mainnet_count = block{ mainnet, true }.transactions();
+    runner.run(suite, "block.deserialize.heap", 20, mainnet_count, [&]() NOEXCEPT
+    {
+        return block{ mainnet, true }.is_valid();
+    });
+
+    // The data constructor reads by slice, this is the virtual reader.
+    runner.run(suite, "block.deserialize.fast", 20, mainnet_count, [&]() NOEXCEPT
+    {
+        stream::in::fast stream{ mainnet };
+        read::bytes::fast source{ stream };
+        return block{ source, true }.is_valid();
+    });
+
+    // The first slab is sized to the high-water mark, so is retained by start.
+    monotonic_arena memory{};
+    runner.run(suite, "block.deserialize.arena", 20, mainnet_count, [&]() NOEXCEPT
+    {
+        memory.start(memory.get_statistics().high_water);
+        stream::in::fast stream{ mainnet };
+        read::bytes::fast source{ stream, &memory };
+        return block{ source, true }.is_valid();
+    });
+
+    // The block memory is detached (as to a cache) and released by its owner.
+    runner.run(suite, "block.deserialize.detach", 20, mainnet_count, [&]() NOEXCEPT
+    {
+        const auto address = memory.start(memory.get_statistics().high_water);
+        stream::in::fast stream{ mainnet };
+        read::bytes::fast source{ stream, &memory };
+        auto instance = std::make_unique<const block>(source, true);
+        const auto valid = !is_zero(memory.detach()) && instance->is_valid();
+        instance.reset();
+        memory.release(address);
+        return valid;
+    });
+
+    // Includes a copy of the buffer, since the view takes ownership.
+    runner.run(suite, "block_view.deserialize", 100, transactions_count, [&]() NOEXCEPT
+    {
+        return block_view{ data_chunk{ data }, true }.is_valid();
+    });
+
+    // Unhashed view parse of a mainnet-sized block, virtual vs. slice reader.
+    runner.run(suite, "transaction_view.parse.fast", 100, mainnet_count, [&]() NOEXCEPT
+    {
+        stream::in::fast stream{ mainnet };
+        read::bytes::fast source{ stream };
+        return parse_views(source, mainnet);
+    });
+
+    runner.run(suite, "transaction_view.parse.slice", 100, mainnet_count, [&]() NOEXCEPT
+    {
+        read::bytes::slice source{ mainnet };
+        return parse_views(source, mainnet);
+    });
+
+    // Native json of a 4MB block, as a json value tree (serialized) and as
+    // streamed from the block and from its view (no intermediate value).
+    const auto large = make_sized_block(fixture, 4'000'000);
+    const block large_block{ large, true };
+    const block_view large_view{ data_chunk{ large }, true };
+    const auto large_count = large_block.transactions();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    runner.run(suite, "block.json.tree", 10, large_count, [&]() NOEXCEPT
+    {
+        return !boost::json::serialize(value_from(large_block)).empty();
+    });
+    BC_POP_WARNING()
+
+    runner.run(suite, "block.json.stream", 10, large_count, [&]() NOEXCEPT
+    {
+        return !to_json(large_block).empty();
+    });
+
+    runner.run(suite, "block_view.json.stream", 10, large_count, [&]() NOEXCEPT
+    {
+        return !to_json(large_view).empty();
+    });
+
+    // Context free and contextual check of a deserialized block.
+    const auto checked = make_checked_block(fixture);
+    runner.run(suite, "block.check", 100, add1(transactions_count), [&]() NOEXCEPT
+    {
+        const block instance{ checked, true };
+        return !instance.check(false) && !instance.check(ctx, false);
+    });
+
+    // The same checks evaluated in place, without chain object allocation.
+    runner.run(suite, "block_view.check", 100, add1(transactions_count), [&]() NOEXCEPT
+    {
+        const block_view view{ data_chunk{ checked }, true };
+        return !view.check(false) && !view.check(ctx, false);
+    });
+
+    // Transaction hashes are not cached on the fixture (not deserialized).
+    runner.run(suite, "block.merkle_root", 100, transactions_count, [&]() NOEXCEPT
+    {
+        hashes leaves(txs.size());
+        std::transform(txs.begin(), txs.end(), leaves.begin(),
+            [](const auto& tx) NOEXCEPT { return tx->hash(false); });
+
+        return sha256::merkle_root(std::move(leaves)) != null_hash;
+    });
+
+    // Serialized identity preimages, hashed serially and then in lanes.
+    data_stack preimages(txs.size());
+    std::transform(txs.begin(), txs.end(), preimages.begin(),
+        [](const auto& tx) NOEXCEPT { return tx->to_data(false); });
+
+    runner.run(suite, "transaction.txids", 100, transactions_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        for (const auto& preimage: preimages)
+            success &= bitcoin_hash(preimage) != null_hash;
+
+        return success;
+    });
+
+    runner.run(suite, "transaction.txids_batch", 100, transactions_count, [&]() NOEXCEPT
+    {
+        sha256::messages_t messages(preimages.size());
+        std::transform(preimages.begin(), preimages.end(), messages.begin(),
+            [](const data_chunk& preimage) NOEXCEPT
+            {
+                return sha256::message_t{ preimage };
+            });
+
+        return sha256::double_hash(messages).size() == preimages.size();
+    });
+
+    runner.run(suite, "transaction.sighash_v0", 100, inputs_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        hash_digest sighash{};
+        const script subscript{};
+        for (const auto& tx: txs)
+            for (auto in = tx->inputs_ptr()->begin();
+                in != tx->inputs_ptr()->end(); ++in)
+                success &= tx->signature_hash(sighash, in, subscript,
+                    prevout_value, {}, script_version::segwit,
+                    coverage::hash_all, rules);
+
+        return success;
+    });
+
+    runner.run(suite, "transaction.sighash_v1", 100, inputs_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        hash_digest sighash{};
+        const script subscript{};
+        for (const auto& tx: txs)
+            for (auto in = tx->inputs_ptr()->begin();
+                in != tx->inputs_ptr()->end(); ++in)
+                success &= tx->signature_hash(sighash, in, subscript,
+                    prevout_value, {}, script_version::taproot,
+                    coverage::hash_default, rules);
+
+        return success;
+    });
+
+    // Script execution and ecdsa verification of each input.
+    runner.run(suite, "interpreter.connect", 10, inputs_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        for (const auto& tx: txs)
+            success &= !tx->connect(ctx);
+
+        return success;
+    });
+
+    // Concurrent script execution and ecdsa verification (excludes coinbase).
+    runner.run(suite, "block.connect_all", 10, fixture.spends(), [&]() NOEXCEPT
+    {
+        size_t tx{};
+        uint32_t input{};
+        return !fixture.connect_all(ctx, tx, input);
+    });
+
+    // Script stack container comparison (excludes transaction validation).
+    connect_inputs<machine::contiguous_stack>(runner,
+        "interpreter.connect.contiguous", txs, ctx, inputs_count);
+    connect_inputs<machine::arena_stack>(runner,
+        "interpreter.connect.arena", txs, ctx, inputs_count);
+
+    // Operation dispatch comparison (switch vs. pre-decoded/threaded).
+    connect_inputs<machine::arena_stack, false>(runner,
+        "interpreter.connect.switch", txs, ctx, inputs_count);
+    connect_inputs<machine::arena_stack, true>(runner,
+        "interpreter.connect.threaded", txs, ctx, inputs_count);
+}
+
+} // namespace bench
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+namespace bench {
+
+constexpr auto suite = "crypto";
+constexpr size_t signatures_count = 64;
+
+void crypto(runner& runner) NOEXCEPT
+{
+    // Fixture (one signature per key, distinct messages).
+    // ------------------------------------------------------------------------
+
+    hashes messages(signatures_count);
+    ec_compresseds points(signatures_count);
+    ec_xonlys xonly_points(signatures_count);
+    std_vector<ec_signature> ecdsa_signatures(signatures_count);
+    std_vector<ec_signature> schnorr_signatures(signatures_count);
+
+    for (size_t index{}; index < signatures_count; ++index)
+    {
+        const auto secret = get_secret(index);
+        messages[index] = get_hash(index);
+        secret_to_public(points[index], secret);
+        std::copy_n(std::next(points[index].begin()), ec_xonly_size,
+            xonly_points[index].begin());
+        ecdsa::sign(ecdsa_signatures[index], secret, messages[index]);
+        schnorr::sign(schnorr_signatures[index], secret, messages[index],
+            null_hash);
+    }
+
+    // Cases.
+    // ------------------------------------------------------------------------
+
+    runner.run(suite, "ecdsa.verify", 100, signatures_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        for (size_t index{}; index < signatures_count; ++index)
+            success &= ecdsa::verify_signature(points[index],
+                messages[index], ecdsa_signatures[index]);
+
+        return success;
+    });
+
+    runner.run(suite, "schnorr.verify", 100, signatures_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        for (size_t index{}; index < signatures_count; ++index)
+            success &= schnorr::verify_signature(xonly_points[index],
+                messages[index], schnorr_signatures[index]);
+
+        return success;
+    });
+
+    const auto key = get_hash(42);
+    const auto counter = slice<zero, array_count<aes256::block>>(key);
+    const auto plain = get_data(1024, 42);
+    runner.run(suite, "aes256.encrypt_ctr", 10'000, plain.size(), [&]() NOEXCEPT
+    {
+        auto bytes = plain;
+        aes256::encrypt_ctr(bytes, counter, key);
+        return bytes != plain;
+    });
+}
+
+} // namespace bench
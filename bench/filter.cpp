@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+namespace bench {
+
+constexpr auto suite = "filter";
+constexpr size_t items_count = 1000;
+constexpr size_t targets_count = 100;
+
+// bip158 basic filter parameters.
+constexpr uint8_t bits = 19;
+constexpr uint64_t rate = 784931;
+
+void filter(runner& runner) NOEXCEPT
+{
+    // Items are script-sized, targets are disjoint from items (no match), so
+    // that matching always traverses the full set.
+    const auto entropy = to_siphash_key(
+        slice<zero, half_hash_size>(get_hash(0)));
+
+    data_stack items(items_count);
+    for (size_t index{}; index < items_count; ++index)
+        items[index] = get_data(25, index);
+
+    data_stack targets(targets_count);
+    for (size_t index{}; index < targets_count; ++index)
+        targets[index] = get_data(25, items_count + index);
+
+    const auto set = golomb::construct(items, bits, entropy, rate);
+
+    runner.run(suite, "golomb.construct", 1'000, items_count, [&]() NOEXCEPT
+    {
+        return !golomb::construct(items, bits, entropy, rate).empty();
+    });
+
+    runner.run(suite, "golomb.match_single", 1'000, items_count, [&]() NOEXCEPT
+    {
+        return !golomb::match_single(set, targets.front(), items_count,
+            entropy, bits, rate);
+    });
+
+    runner.run(suite, "golomb.match_stack", 1'000, items_count, [&]() NOEXCEPT
+    {
+        return !golomb::match_stack(set, targets, items_count, entropy, bits,
+            rate);
+    });
+
+    runner.run(suite, "golomb.match_many", 1'000, items_count, [&]() NOEXCEPT
+    {
+        return !golomb::match_many(set, targets, items_count, entropy, bits,
+            rate);
+    });
+
+    runner.run(suite, "siphash.items", 1'000, items_count, [&]() NOEXCEPT
+    {
+        return siphash(entropy, items).size() == items_count;
+    });
+}
+
+} // namespace bench
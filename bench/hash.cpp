@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+namespace bench {
+
+constexpr auto suite = "hash";
+constexpr size_t keys_count = 1024;
+constexpr size_t leaves_count = 2048;
+
+void hash(runner& runner) NOEXCEPT
+{
+    const auto pair = get_data(2 * hash_size, 1);
+    const auto kilobyte = get_data(1024, 2);
+
+    data_stack keys(keys_count);
+    for (size_t index{}; index < keys_count; ++index)
+        keys[index] = get_data(ec_compressed_size, index);
+
+    hashes leaves(leaves_count);
+    for (size_t index{}; index < leaves_count; ++index)
+        leaves[index] = get_hash(index);
+
+    runner.run(suite, "sha256x2.64", 1'000'000, one, [&]() NOEXCEPT
+    {
+        return bitcoin_hash(pair) != null_hash;
+    });
+
+    runner.run(suite, "sha256.1024", 100'000, kilobyte.size(), [&]() NOEXCEPT
+    {
+        return sha256_hash(kilobyte) != null_hash;
+    });
+
+    runner.run(suite, "rmd160.1024", 100'000, kilobyte.size(), [&]() NOEXCEPT
+    {
+        return rmd160_hash(kilobyte) != null_short_hash;
+    });
+
+    runner.run(suite, "bitcoin_short_hash.keys", 100, keys_count, [&]() NOEXCEPT
+    {
+        auto success = true;
+        for (const auto& key: keys)
+            success &= bitcoin_short_hash(key) != null_short_hash;
+
+        return success;
+    });
+
+    runner.run(suite, "bitcoin_short_hashes.keys", 100, keys_count, [&]() NOEXCEPT
+    {
+        return bitcoin_short_hashes(keys).size() == keys_count;
+    });
+
+    // Includes a copy of the leaves, since the root consumes them.
+    runner.run(suite, "merkle_root.2048", 1'000, leaves_count, [&]() NOEXCEPT
+    {
+        return sha256::merkle_root(hashes{ leaves }) != null_hash;
+    });
+}
+
+} // namespace bench
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <string>
+
+BC_USE_LIBBITCOIN_MAIN
+
+// libbitcoin-system-bench [--csv] [--iterations=<count>] [--filter=<text>]
+// Runs all suites (or cases with "suite.name" containing text), and writes
+// results as JSON (default) or CSV to stdout. Iterations overrides the
+// default iteration count of each case, which is sized for release builds.
+int bc::system::main(int argc, char* argv[])
+{
+    using namespace bench;
+    set_utf8_stdio();
+
+    auto csv = false;
+    size_t iterations{};
+    std::string filter{};
+    const std::string iterations_option{ "--iterations=" };
+    const std::string filter_option{ "--filter=" };
+
+    for (auto arg = 1; arg < argc; ++arg)
+    {
+        const std::string option{ argv[arg] };
+
+        if (option == "--csv")
+        {
+            csv = true;
+        }
+        else if (starts_with(option, filter_option))
+        {
+            filter = option.substr(filter_option.size());
+        }
+        else if (!starts_with(option, iterations_option) || !deserialize(
+            iterations, option.substr(iterations_option.size())))
+        {
+            system::cerr << "usage: libbitcoin-system-bench [--csv] "
+                "[--iterations=<count>] [--filter=<text>]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    runner runner{ iterations, filter };
+    bench::hash(runner);
+    bench::crypto(runner);
+    bench::radix(runner);
+    bench::filter(runner);
+    bench::chain(runner);
+
+    if (csv)
+        write_csv(system::cout, runner.get());
+    else
+        write_json(system::cout, runner.get());
+
+    for (const auto& result: runner.get())
+        if (!is_zero(result.failures))
+            return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+namespace bench {
+
+constexpr auto suite = "radix";
+
+void radix(runner& runner) NOEXCEPT
+{
+    // Address-sized payloads (version + short hash + checksum, witness hash).
+    const auto payload = get_data(25, 1);
+    const auto program = get_data(hash_size, 2);
+    const auto kilobyte = get_data(1024, 3);
+    const auto extended = get_data(82, 4);
+    const auto base58 = encode_base58(payload);
+    const auto base58_extended = encode_base58(extended);
+    const data_stack payloads(100, payload);
+    const auto base58s = encode_base58_many(payloads);
+    const auto short_program = get_data(short_hash_size, 5);
+    const data_chunk versions(100, 0x00);
+    const data_stack programs(100, short_program);
+    const auto bech32s = bech32_encode_many("bc", versions, programs);
+    const auto base32 = encode_base32(program);
+    const auto base16 = encode_base16(kilobyte);
+    const auto megabyte = get_data(1024 * 1024, 6);
+    const auto base16_megabyte = encode_base16(megabyte);
+    const auto hash = sha256_hash(program);
+    const auto base16_hash = encode_hash(hash);
+
+    runner.run(suite, "base58.encode", 100'000, payload.size(), [&]() NOEXCEPT
+    {
+        return !encode_base58(payload).empty();
+    });
+
+    runner.run(suite, "base58.decode", 100'000, payload.size(), [&]() NOEXCEPT
+    {
+        data_chunk out{};
+        return decode_base58(out, base58);
+    });
+
+    runner.run(suite, "base58.encode.extended", 100'000, extended.size(),
+        [&]() NOEXCEPT
+    {
+        return !encode_base58(extended).empty();
+    });
+
+    runner.run(suite, "base58.decode.extended", 100'000, extended.size(),
+        [&]() NOEXCEPT
+    {
+        data_chunk out{};
+        return decode_base58(out, base58_extended);
+    });
+
+    runner.run(suite, "base58.encode_many", 1'000,
+        payloads.size() * payload.size(), [&]() NOEXCEPT
+    {
+        return encode_base58_many(payloads).size() == payloads.size();
+    });
+
+    runner.run(suite, "base58.decode_many", 1'000,
+        payloads.size() * payload.size(), [&]() NOEXCEPT
+    {
+        data_stack out{};
+        return decode_base58_many(out, base58s);
+    });
+
+    runner.run(suite, "base32.encode", 100'000, program.size(), [&]() NOEXCEPT
+    {
+        return !encode_base32(program).empty();
+    });
+
+    runner.run(suite, "base32.decode", 100'000, program.size(), [&]() NOEXCEPT
+    {
+        data_chunk out{};
+        return decode_base32(out, base32);
+    });
+
+    runner.run(suite, "bech32.build", 100'000, short_program.size(),
+        [&]() NOEXCEPT
+    {
+        return !encode_base32(bech32_build_checked(0, short_program, "bc"))
+            .empty();
+    });
+
+    runner.run(suite, "bech32.encode_many", 1'000,
+        programs.size() * short_program.size(), [&]() NOEXCEPT
+    {
+        return bech32_encode_many("bc", versions, programs).size() ==
+            programs.size();
+    });
+
+    runner.run(suite, "bech32.decode_many", 1'000,
+        programs.size() * short_program.size(), [&]() NOEXCEPT
+    {
+        data_chunk out_versions{};
+        data_stack out_programs{};
+        return bech32_decode_many(out_versions, out_programs, "bc", bech32s);
+    });
+
+    runner.run(suite, "base16.encode", 100'000, kilobyte.size(), [&]() NOEXCEPT
+    {
+        return !encode_base16(kilobyte).empty();
+    });
+
+    runner.run(suite, "base16.decode", 100'000, kilobyte.size(), [&]() NOEXCEPT
+    {
+        data_chunk out{};
+        return decode_base16(out, base16);
+    });
+
+    runner.run(suite, "base16.encode.megabyte", 100, megabyte.size(),
+        [&]() NOEXCEPT
+    {
+        return !encode_base16(megabyte).empty();
+    });
+
+    runner.run(suite, "base16.decode.megabyte", 100, megabyte.size(),
+        [&]() NOEXCEPT
+    {
+        data_chunk out{};
+        return decode_base16(out, base16_megabyte);
+    });
+
+    runner.run(suite, "base16.encode_hash", 1'000'000, hash.size(),
+        [&]() NOEXCEPT
+    {
+        return !encode_hash(hash).empty();
+    });
+
+    runner.run(suite, "base16.decode_hash", 1'000'000, hash.size(),
+        [&]() NOEXCEPT
+    {
+        hash_digest out{};
+        return decode_hash(out, base16_hash);
+    });
+
+    runner.run(suite, "base16.writer", 100, megabyte.size(), [&]() NOEXCEPT
+    {
+        std::string out{};
+        write::base16::text writer{ out };
+        writer.write_bytes(megabyte);
+        writer.flush();
+        return !out.empty();
+    });
+
+    runner.run(suite, "base16.reader", 100, megabyte.size(), [&]() NOEXCEPT
+    {
+        read::base16::copy reader{ base16_megabyte };
+        return reader.read_bytes(megabyte.size()).size() == megabyte.size();
+    });
+}
+
+} // namespace bench
@@ -16,10 +16,15 @@
 #                               Default: OFF
 # -Denable-shani=<ON/OFF>     Use Intel/ARM SHA Extensions.
 #                               Default: OFF
+# -Denable-aesni=<ON/OFF>     Use Intel AES New Instructions.
+#                               Default: OFF
 # -Dwith-ultrafast=<ON/OFF>   Use shrec/UltrafastSecp256k1 library.
 #                               Default: OFF
 # -Dwith-secp256k1=<ON/OFF>   Use bitcoin-core/secp256k1 library.
 #                               Default: ON
+# -Dwith-threaded-dispatch=<ON/OFF>
+#                             Use pre-decoded script interpreter dispatch.
+#                               Default: OFF
 # --build-boost               Build Boost libraries
 # --build-secp256k1           Build libsecp256k1 libraries
 # --build-ultrafast           Build UltrafastSecp256k1 libraries
@@ -1060,10 +1065,15 @@ help()
     msg "                              Default: OFF"
     msg "-Denable-shani=<ON/OFF>     Use Intel/ARM SHA Extensions."
     msg "                              Default: OFF"
+    msg "-Denable-aesni=<ON/OFF>     Use Intel AES New Instructions."
+    msg "                              Default: OFF"
     msg "-Dwith-ultrafast=<ON/OFF>   Use shrec/UltrafastSecp256k1 library."
     msg "                              Default: OFF"
     msg "-Dwith-secp256k1=<ON/OFF>   Use bitcoin-core/secp256k1 library."
     msg "                              Default: ON"
+    msg "-Dwith-threaded-dispatch=<ON/OFF>"
+    msg "                            Use pre-decoded script interpreter dispatch."
+    msg "                              Default: OFF"
     msg "--build-boost               Build Boost libraries"
     msg "--build-secp256k1           Build libsecp256k1 libraries"
     msg "--build-ultrafast           Build UltrafastSecp256k1 libraries"
@@ -16,10 +16,15 @@
 #                               Default: --disable-sse41
 # --<enable/disable>-shani    Use Intel/ARM SHA Extensions.
 #                               Default: --disable-shani
+# --<enable/disable>-aesni    Use Intel AES New Instructions.
+#                               Default: --disable-aesni
 # --<with/without>-ultrafast  Use shrec/UltrafastSecp256k1 library.
 #                               Default: --without-ultrafast
 # --<with/without>-secp256k1  Use bitcoin-core/secp256k1 library.
 #                               Default: --with-secp256k1
+# --<with/without>-threaded-dispatch
+#                             Use pre-decoded script interpreter dispatch.
+#                               Default: --without-threaded-dispatch
 # --build-boost               Build Boost libraries
 # --build-secp256k1           Build libsecp256k1 libraries
 # --build-ultrafast           Build UltrafastSecp256k1 libraries
@@ -1212,10 +1217,15 @@ help()
     msg "                              Default: --disable-sse41"
     msg "--<enable/disable>-shani    Use Intel/ARM SHA Extensions."
     msg "                              Default: --disable-shani"
+    msg "--<enable/disable>-aesni    Use Intel AES New Instructions."
+    msg "                              Default: --disable-aesni"
     msg "--<with/without>-ultrafast  Use shrec/UltrafastSecp256k1 library."
     msg "                              Default: --without-ultrafast"
     msg "--<with/without>-secp256k1  Use bitcoin-core/secp256k1 library."
     msg "                              Default: --with-secp256k1"
+    msg "--<with/without>-threaded-dispatch"
+    msg "                            Use pre-decoded script interpreter dispatch."
+    msg "                              Default: --without-threaded-dispatch"
     msg "--build-boost               Build Boost libraries"
     msg "--build-secp256k1           Build libsecp256k1 libraries"
     msg "--build-ultrafast           Build UltrafastSecp256k1 libraries"
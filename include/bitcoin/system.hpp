@@ -26,6 +26,7 @@
 #include <bitcoin/system/funclets.hpp>
 #include <bitcoin/system/have.hpp>
 #include <bitcoin/system/literals.hpp>
+#include <bitcoin/system/monotonic_arena.hpp>
 #include <bitcoin/system/preprocessor.hpp>
 #include <bitcoin/system/settings.hpp>
 #include <bitcoin/system/typelets.hpp>
@@ -82,7 +83,9 @@
 #include <bitcoin/system/chain/json/script.hpp>
 #include <bitcoin/system/chain/json/transaction.hpp>
 #include <bitcoin/system/chain/json/witness.hpp>
+#include <bitcoin/system/chain/json/writer.hpp>
 #include <bitcoin/system/chain/views/block_view.hpp>
+#include <bitcoin/system/chain/views/script_view.hpp>
 #include <bitcoin/system/chain/views/transaction_view.hpp>
 #include <bitcoin/system/config/authority.hpp>
 #include <bitcoin/system/config/base16.hpp>
@@ -121,6 +124,7 @@
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
 #include <bitcoin/system/crypto/secp256k1_batch.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 #include <bitcoin/system/data/array_cast.hpp>
 #include <bitcoin/system/data/byte_cast.hpp>
 #include <bitcoin/system/data/collection.hpp>
@@ -132,9 +136,11 @@
 #include <bitcoin/system/data/data_slice.hpp>
 #include <bitcoin/system/data/exclusive_slice.hpp>
 #include <bitcoin/system/data/external_ptr.hpp>
+#include <bitcoin/system/data/flat_hash_set.hpp>
 #include <bitcoin/system/data/iterable.hpp>
 #include <bitcoin/system/data/memory.hpp>
 #include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/data/sequence_slot.hpp>
 #include <bitcoin/system/data/string.hpp>
 #include <bitcoin/system/endian/batch.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -162,6 +168,7 @@
 #include <bitcoin/system/hash/algorithm.hpp>
 #include <bitcoin/system/hash/algorithms.hpp>
 #include <bitcoin/system/hash/checksum.hpp>
+#include <bitcoin/system/hash/digest_set.hpp>
 #include <bitcoin/system/hash/functions.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/hash/hkdf.hpp>
@@ -188,11 +195,15 @@
 #include <bitcoin/system/intrinsics/intel/intel_128.hpp>
 #include <bitcoin/system/intrinsics/intel/intel_256.hpp>
 #include <bitcoin/system/intrinsics/intel/intel_512.hpp>
+#include <bitcoin/system/intrinsics/intel/intel_aes.hpp>
+#include <bitcoin/system/intrinsics/intel/intel_hex.hpp>
 #include <bitcoin/system/intrinsics/intel/intel_sha.hpp>
 #include <bitcoin/system/intrinsics/neon/neon.hpp>
 #include <bitcoin/system/intrinsics/neon/neon_128.hpp>
 #include <bitcoin/system/intrinsics/neon/neon_sha.hpp>
 #include <bitcoin/system/intrinsics/none/none_128.hpp>
+#include <bitcoin/system/intrinsics/none/none_aes.hpp>
+#include <bitcoin/system/intrinsics/none/none_hex.hpp>
 #include <bitcoin/system/intrinsics/none/none_sha.hpp>
 #include <bitcoin/system/intrinsics/sve/sve.hpp>
 #include <bitcoin/system/machine/interpreter.hpp>
@@ -202,7 +213,11 @@
 #include <bitcoin/system/machine/number_chunk.hpp>
 #include <bitcoin/system/machine/number_integer.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/script_cache.hpp>
 #include <bitcoin/system/machine/stack.hpp>
+#include <bitcoin/system/machine/stack_arena.hpp>
+#include <bitcoin/system/machine/stack_chunk.hpp>
+#include <bitcoin/system/machine/standard.hpp>
 #include <bitcoin/system/math/addition.hpp>
 #include <bitcoin/system/math/bits.hpp>
 #include <bitcoin/system/math/bytes.hpp>
@@ -257,6 +272,8 @@
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256t_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitreader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
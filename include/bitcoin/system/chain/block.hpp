@@ -63,6 +63,7 @@ public:
     block(stream::in::fast& stream, bool witness) NOEXCEPT;
     block(std::istream& stream, bool witness) NOEXCEPT;
     block(reader& source, bool witness) NOEXCEPT;
+    block(slice_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -143,6 +144,14 @@ public:
     code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Connect all inputs concurrently (turbo) or sequentially, without
+    /// signature capture (capture accumulators are thread-static).
+    /// Fails on the first missing prevout before connecting any input,
+    /// otherwise skips inputs above the lowest failure and sets the position
+    /// of the first failing input, where the coinbase is transaction zero.
+    code connect_all(const context& ctx, size_t& tx_index,
+        uint32_t& input_index, bool turbo=true) const NOEXCEPT;
+
     /// Populate previous outputs internal to the block.
     /// Fails if any populated prevout is internally immature or locked.
     code populate(const context& ctx) const NOEXCEPT;
@@ -150,6 +159,7 @@ public:
 protected:
     block(stream::in::fast&& stream, bool witness) NOEXCEPT;
     block(reader&& source, bool witness) NOEXCEPT;
+    block(slice_reader&& source, bool witness) NOEXCEPT;
     block(const chain::header::cptr& header,
         const chain::transactions_cptr& txs, bool valid) NOEXCEPT;
 
@@ -188,7 +198,8 @@ protected:
 private:
     typedef struct { size_t nominal; size_t witnessed; } sizes;
 
-    static block from_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    static block from_data(Source& source, bool witness) NOEXCEPT;
     static sizes serialized_size(const transaction_cptrs& txs) NOEXCEPT;
 
     // context free
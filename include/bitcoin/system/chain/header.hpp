@@ -67,6 +67,7 @@ public:
     header(stream::in::fast& stream) NOEXCEPT;
     header(std::istream& stream) NOEXCEPT;
     header(reader& source) NOEXCEPT;
+    header(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -123,6 +124,7 @@ public:
 protected:
     header(stream::in::fast&& stream) NOEXCEPT;
     header(reader&& source) NOEXCEPT;
+    header(slice_reader&& source) NOEXCEPT;
     header(uint32_t version, hash_digest&& previous_block_hash,
         hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
         uint32_t nonce, bool valid) NOEXCEPT;
@@ -146,7 +148,10 @@ protected:
     // error::incorrect_proof_of_work
 
 private:
-    static header from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static header from_data(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
 
     // Header should be stored as shared (adds 16 bytes).
     // copy: 4 * 32 + 2 * 256 + 1 = 81 bytes (vs. 16 when shared).
@@ -71,6 +71,7 @@ public:
     input(stream::in::fast& stream) NOEXCEPT;
     input(std::istream& stream) NOEXCEPT;
     input(reader& source) NOEXCEPT;
+    input(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -120,6 +121,7 @@ public:
 protected:
     input(stream::in::fast&& stream) NOEXCEPT;
     input(reader&& source) NOEXCEPT;
+    input(slice_reader&& source) NOEXCEPT;
     input(const chain::point::cptr& point, const chain::script::cptr& script,
         const chain::witness::cptr& witness, uint32_t sequence,
         bool valid) NOEXCEPT;
@@ -127,7 +129,8 @@ protected:
 private:
     typedef struct { size_t nominal; size_t witnessed; } sizes;
 
-    static input from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static input from_data(Source& source) NOEXCEPT;
     static sizes serialized_size(const chain::script& script) NOEXCEPT;
     static sizes serialized_size(const chain::script& script,
         const chain::witness& witness) NOEXCEPT;
@@ -139,6 +142,8 @@ private:
     size_t nominal_size() const NOEXCEPT;
     size_t witnessed_size() const NOEXCEPT;
     bool set_witness(reader& source) NOEXCEPT;
+    bool set_witness(slice_reader& source) NOEXCEPT;
+    bool set_witness(const chain::witness::cptr& witness) NOEXCEPT;
 
     const chain::witness& get_witness() const NOEXCEPT;
     const chain::witness::cptr& get_witness_cptr() const NOEXCEPT;
@@ -31,5 +31,6 @@
 #include <bitcoin/system/chain/json/script.hpp>
 #include <bitcoin/system/chain/json/transaction.hpp>
 #include <bitcoin/system/chain/json/witness.hpp>
+#include <bitcoin/system/chain/json/writer.hpp>
 
 #endif
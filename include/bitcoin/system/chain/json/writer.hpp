@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_JSON_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_JSON_WRITER_HPP
+
+#include <iostream>
+#include <string>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/views/block_view.hpp>
+#include <bitcoin/system/chain/views/transaction_view.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Streaming native json, the same text as serialize(value_from(instance)),
+/// written to the sink as produced (no intermediate json value is built).
+/// Views are written from the block buffer, without chain object allocation.
+/// A transaction view must be hashed for its "hash" value to be populated.
+BC_API void to_json(writer& sink, const block& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const block_view& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const header& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const transaction& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const transaction_view& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const input& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const output& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const point& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const script& instance) NOEXCEPT;
+BC_API void to_json(writer& sink, const witness& instance) NOEXCEPT;
+
+/// Streaming native json to a std::ostream.
+template <typename Type>
+inline void to_json(std::ostream& stream, const Type& instance) NOEXCEPT
+{
+    write::bytes::ostream sink{ stream };
+    to_json(sink, instance);
+}
+
+/// Native json text.
+template <typename Type>
+inline std::string to_json(const Type& instance) NOEXCEPT
+{
+    std::string text{};
+    write::bytes::text sink{ text };
+    to_json(sink, instance);
+    sink.flush();
+    return text;
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_OPERATION_HPP
 
 #include <memory>
+#include <string_view>
 #include <bitcoin/system/chain/enums/opcode.hpp>
 #include <bitcoin/system/chain/enums/script_pattern.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -43,6 +44,7 @@ public:
     static constexpr uint8_t opcode_to_positive(opcode code) NOEXCEPT;
     static constexpr uint8_t opcode_to_nonnegative(opcode code) NOEXCEPT;
     static constexpr size_t opcode_to_maximum_size(opcode code) NOEXCEPT;
+    static constexpr std::string_view opcode_to_prefix(opcode code, size_t size) NOEXCEPT;
     static constexpr opcode opcode_from_size(size_t size) NOEXCEPT;
     static constexpr opcode opcode_from_positive(uint8_t value) NOEXCEPT;
     static constexpr opcode opcode_from_nonnegative(uint8_t value) NOEXCEPT;
@@ -114,6 +116,7 @@ public:
     operation(stream::in::fast& stream) NOEXCEPT;
     operation(std::istream& stream) NOEXCEPT;
     operation(reader& source) NOEXCEPT;
+    operation(slice_reader& source) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     // TODO: a byte-deserialized operation cannot be invalid unless empty.
@@ -157,6 +160,7 @@ public:
 protected:
     operation(stream::in::fast&& stream) NOEXCEPT;
     operation(reader&& source) NOEXCEPT;
+    operation(slice_reader&& source) NOEXCEPT;
     operation(opcode code, const chunk_cptr& push_data_ptr,
         bool underflow) NOEXCEPT;
 
@@ -164,8 +168,12 @@ private:
     // So script may call count_op.
     friend class script;
     static bool count_op(reader& source) NOEXCEPT;
+    static bool count_op(slice_reader& source) NOEXCEPT;
+    template <typename Source>
+    static bool skip_op(Source& source) NOEXCEPT;
 
-    static operation from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static operation from_data(Source& source) NOEXCEPT;
     static operation from_push_data(const chunk_cptr& data,
         bool minimal) NOEXCEPT;
 
@@ -175,7 +183,8 @@ private:
     static const data_chunk& no_data() NOEXCEPT;
     static const chunk_cptr& no_data_cptr() NOEXCEPT;
     static const chunk_cptr& any_data_cptr() NOEXCEPT;
-    static uint32_t read_data_size(opcode code, reader& source) NOEXCEPT;
+    template <typename Source>
+    static uint32_t read_data_size(opcode code, Source& source) NOEXCEPT;
     static inline opcode opcode_from_data(const data_chunk& push_data,
         bool minimal) NOEXCEPT
     {
@@ -55,6 +55,7 @@ public:
     output(stream::in::fast& stream) NOEXCEPT;
     output(std::istream& stream) NOEXCEPT;
     output(reader& source) NOEXCEPT;
+    output(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -97,11 +98,13 @@ public:
 protected:
     output(stream::in::fast&& stream) NOEXCEPT;
     output(reader&& source) NOEXCEPT;
+    output(slice_reader&& source) NOEXCEPT;
     output(uint64_t value, const chain::script::cptr& script,
         bool valid) NOEXCEPT;
 
 private:
-    static output from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static output from_data(Source& source) NOEXCEPT;
     static size_t serialized_size(const chain::script& script,
         uint64_t value) NOEXCEPT;
 
@@ -59,6 +59,7 @@ public:
     point(stream::in::fast& stream) NOEXCEPT;
     point(std::istream& stream) NOEXCEPT;
     point(reader& source) NOEXCEPT;
+    point(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -87,11 +88,15 @@ public:
 protected:
     point(stream::in::fast&& stream) NOEXCEPT;
     point(reader&& source) NOEXCEPT;
+    point(slice_reader&& source) NOEXCEPT;
     point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT;
     point(const hash_digest& hash, uint32_t index, bool valid) NOEXCEPT;
 
 private:
-    static point from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static point from_data(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
 
     // The index is consensus-serialized as a fixed 4 bytes, however it is
     // effectively bound to 2^17 by the block byte size limit.
@@ -113,6 +118,7 @@ typedef std_vector<point> points;
 /// Constant reference optimizers.
 using point_cref = std::reference_wrapper<const point>;
 using unordered_set_of_point_cref = std::unordered_set<point_cref>;
+using flat_set_of_point_cref = flat_hash_set<point>;
 BC_API bool operator<(const point_cref& left, const point_cref& right) NOEXCEPT;
 BC_API bool operator==(const point_cref& left, const point_cref& right) NOEXCEPT;
 BC_API bool operator!=(const point_cref& left, const point_cref& right) NOEXCEPT;
@@ -118,6 +118,7 @@ public:
     script(stream::in::fast& stream, bool prefix) NOEXCEPT;
     script(std::istream& stream, bool prefix) NOEXCEPT;
     script(reader& source, bool prefix) NOEXCEPT;
+    script(slice_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     script(const std::string_view& mnemonic, bool bitcoind=false) NOEXCEPT;
@@ -182,6 +183,9 @@ public:
 protected:
     script(stream::in::fast&& stream, bool prefix) NOEXCEPT;
     script(reader&& source, bool prefix) NOEXCEPT;
+    script(slice_reader&& source, bool prefix) NOEXCEPT;
+    script(operations&& ops, bool valid, bool easier, bool failer,
+        bool roller, size_t size) NOEXCEPT;
     script(const operations& ops, bool valid, bool easier, bool failer,
         bool roller, size_t size) NOEXCEPT;
 
@@ -189,10 +193,12 @@ private:
     static inline size_t op_size(size_t total, const operation& op) NOEXCEPT;
     static script from_operations(operations&& ops) NOEXCEPT;
     static script from_operations(const operations& ops) NOEXCEPT;
-    static script from_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static script from_data(Source& source, bool prefix) NOEXCEPT;
     static script from_string(const std::string_view& mnemonic,
         bool bitcoind=false) NOEXCEPT;
-    static size_t op_count(reader& source) NOEXCEPT;
+    template <typename Source>
+    static size_t op_count(Source& source) NOEXCEPT;
     static size_t serialized_size(const operations& ops) NOEXCEPT;
 
     // Script should be stored as shared.
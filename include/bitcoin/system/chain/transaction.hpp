@@ -76,6 +76,7 @@ public:
     transaction(stream::in::fast& stream, bool witness) NOEXCEPT;
     transaction(std::istream& stream, bool witness) NOEXCEPT;
     transaction(reader& source, bool witness) NOEXCEPT;
+    transaction(slice_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -174,9 +175,17 @@ public:
     code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Connect inputs concurrently (turbo) or sequentially, without signature
+    /// capture (capture accumulators are thread-static). Fails on the first
+    /// missing prevout before connecting any input, otherwise skips inputs
+    /// above the lowest failure and sets the index of the first failing input.
+    code connect_all(const context& ctx, uint32_t& index,
+        bool turbo=true) const NOEXCEPT;
+
 protected:
     transaction(stream::in::fast&& stream, bool witness) NOEXCEPT;
     transaction(reader&& source, bool witness) NOEXCEPT;
+    transaction(slice_reader&& source, bool witness) NOEXCEPT;
     transaction(uint32_t version, const inputs_cptr& inputs,
         const outputs_cptr& outputs, uint32_t locktime, bool segregated,
         bool valid) NOEXCEPT;
@@ -253,7 +262,12 @@ private:
         hash_digest scripts;
     } only_cache;
 
-    static transaction from_data(reader& source, bool witness) NOEXCEPT;
+    // Accumulated invariant sighash preimage prefix, by sighash flag family.
+    typedef std_array<accumulator<sha256>, 3> v0_midstates;
+    typedef std_array<accumulator<sha256>, 4> v1_midstates;
+
+    template <typename Source>
+    static transaction from_data(Source& source, bool witness) NOEXCEPT;
     static bool segregated(const chain::inputs& inputs) NOEXCEPT;
     static bool segregated(const input_cptrs& inputs) NOEXCEPT;
     static sizes serialized_size(const input_cptrs& inputs,
@@ -262,7 +276,8 @@ private:
     input_iterator input_at(uint32_t index) const NOEXCEPT;
     chain::points points() const NOEXCEPT;
 
-    // delegated
+    // delegated (block connects inputs across transactions concurrently)
+    friend class block;
     code connect_input(const context& ctx, const input_iterator& it,
         const signatures& capture) const NOEXCEPT;
 
@@ -279,6 +294,12 @@ private:
     void set_x1_base_hash() const NOEXCEPT;
     void set_x2_base_hash() const NOEXCEPT;
     void set_v1_only_hash() const NOEXCEPT;
+    void set_v0_midstates() const NOEXCEPT;
+    void set_v1_midstates() const NOEXCEPT;
+
+    // Set all applicable caches, so that input connect is thread safe.
+    // All prevouts must be populated (version 1 hashes commit to them all).
+    void set_signature_hashes() const NOEXCEPT;
 
     hash_digest x1_base_hash_points() const NOEXCEPT;
     hash_digest x1_base_hash_sequences() const NOEXCEPT;
@@ -298,6 +319,10 @@ private:
     const hash_digest& double_hash_sequences() const NOEXCEPT;
     const hash_digest& double_hash_outputs() const NOEXCEPT;
 
+    // Set midstate cache if not set, so not thread safe unless cached.
+    const accumulator<sha256>& midstate_v0(uint8_t sighash_flags) const NOEXCEPT;
+    const accumulator<sha256>& midstate_v1(uint8_t sighash_flags) const NOEXCEPT;
+
     // Signature hashing.
     // ------------------------------------------------------------------------
 
@@ -346,6 +371,10 @@ private:
     mutable std::shared_ptr<base_cache> x1_base_cache_{};
     mutable std::shared_ptr<base_cache> x2_base_cache_{};
     mutable std::shared_ptr<only_cache> v1_only_cache_{};
+
+    // Signature hash prefix caching (witness and taproot).
+    mutable std::shared_ptr<v0_midstates> v0_midstates_{};
+    mutable std::shared_ptr<v1_midstates> v1_midstates_{};
 };
 
 typedef std_vector<transaction> transactions;
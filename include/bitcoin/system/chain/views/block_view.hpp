@@ -48,19 +48,51 @@ public:
     hash_digest hash() const NOEXCEPT;
     size_t transactions() const NOEXCEPT;
     const transaction_views& views() const NOEXCEPT;
+    data_slice header_slice() const NOEXCEPT;
     size_t serialized_size(bool witness) const NOEXCEPT;
+    size_t weight() const NOEXCEPT;
+    size_t spends() const NOEXCEPT;
 
     /// Validation.
     code identify() const NOEXCEPT;
     code identify(const context& ctx) const NOEXCEPT;
 
+    /// Mirrors block::check(), evaluated over the buffer in place.
+    code check(bool identity=true) const NOEXCEPT;
+
+    /// Mirrors block::check(ctx), evaluated over the buffer in place.
+    code check(const context& ctx, bool identity=true) const NOEXCEPT;
+
+    /// Prevout-independent subset of block::accept(ctx). Legacy sigops are a
+    /// lower bound on block sigops, so any block rejected here is also
+    /// rejected by block::accept(ctx). Overspend is not evaluated.
+    code accept(const context& ctx) const NOEXCEPT;
+
 protected:
     /// Validation helpers.
     bool is_malleated() const NOEXCEPT;
     bool is_invalid_merkle_root() const NOEXCEPT;
     bool is_invalid_witness_commitment() const NOEXCEPT;
 
+    /// Check helpers.
+    bool is_oversized() const NOEXCEPT;
+    bool is_first_non_coinbase() const NOEXCEPT;
+    bool is_extra_coinbases() const NOEXCEPT;
+    bool is_forward_reference() const NOEXCEPT;
+    bool is_internal_double_spend() const NOEXCEPT;
+    bool is_overweight() const NOEXCEPT;
+    bool is_invalid_coinbase_script(size_t height) const NOEXCEPT;
+    bool is_hash_limit_exceeded() const NOEXCEPT;
+    bool is_signature_operations_limited(bool bip141) const NOEXCEPT;
+
 private:
+    // Identity hashing.
+    void set_hashes() NOEXCEPT;
+
+    code malleated_or(const code& ec) const NOEXCEPT;
+    code check_transactions() const NOEXCEPT;
+    code check_transactions(const context& ctx) const NOEXCEPT;
+
     // Malleation.
     static bool is_malleable64(const transaction_views& txs) NOEXCEPT;
     bool is_malleated32() const NOEXCEPT;
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_VIEW_HPP
+
+#include <iterator>
+#include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Operation referenced in place within a serialized script. Push data is a
+/// slice of the script buffer, valid for the lifetime of the script view.
+/// As with operation, an underflow has any invalid code and its data is the
+/// remainder of the script (from and including its opcode byte).
+struct operation_view
+{
+    opcode code;
+    data_slice data;
+    bool underflow;
+};
+
+/// Script held as its serialized bytes in a single allocation (by the reader
+/// allocator), with operations decoded in place by iteration (no operation
+/// allocation). This is for read-only use (json serialization of views).
+/// chain::script, operation and the interpreter do not use this view, so
+/// evaluation requires conversion to script, which allocates each operation.
+class BC_API script_view final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(script_view);
+
+    /// Forward iterator decoding each operation in place.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = operation_view;
+        using difference_type = ptrdiff_t;
+        using pointer = const operation_view*;
+        using reference = const operation_view&;
+
+        const_iterator() NOEXCEPT;
+        const_iterator(const uint8_t* begin, const uint8_t* end) NOEXCEPT;
+
+        reference operator*() const NOEXCEPT;
+        pointer operator->() const NOEXCEPT;
+        const_iterator& operator++() NOEXCEPT;
+        const_iterator operator++(int) NOEXCEPT;
+        bool operator==(const const_iterator& other) const NOEXCEPT;
+        bool operator!=(const const_iterator& other) const NOEXCEPT;
+
+    private:
+        void decode() NOEXCEPT;
+
+        const uint8_t* position_;
+        const uint8_t* next_;
+        const uint8_t* end_;
+        operation_view op_;
+    };
+
+    /// Default script view is an invalid empty script.
+    script_view() NOEXCEPT;
+
+    /// Data is the serialized script (without size prefix).
+    script_view(data_chunk&& data) NOEXCEPT;
+    script_view(const data_slice& data, bool prefix) NOEXCEPT;
+    script_view(reader& source, bool prefix) NOEXCEPT;
+    script_view(const script& script) NOEXCEPT;
+
+    /// Operators.
+    bool operator==(const script_view& other) const NOEXCEPT;
+    bool operator!=(const script_view& other) const NOEXCEPT;
+
+    /// Serialization.
+    data_chunk to_data(bool prefix) const NOEXCEPT;
+    void to_data(writer& sink, bool prefix) const NOEXCEPT;
+
+    /// Properties.
+    bool is_valid() const NOEXCEPT;
+    bool is_underflow() const NOEXCEPT;
+    const data_chunk& data() const NOEXCEPT;
+    size_t serialized_size(bool prefix) const NOEXCEPT;
+
+    /// Operations.
+    const_iterator begin() const NOEXCEPT;
+    const_iterator end() const NOEXCEPT;
+    size_t op_count() const NOEXCEPT;
+
+    /// Allocate the equivalent script (operations and push data).
+    script to_script() const NOEXCEPT;
+
+protected:
+    script_view(stream::in::fast&& stream, bool prefix) NOEXCEPT;
+    script_view(reader&& source, bool prefix) NOEXCEPT;
+    script_view(bool valid, data_chunk&& data) NOEXCEPT;
+
+private:
+    static script_view from_data(reader& source, bool prefix) NOEXCEPT;
+
+    data_chunk data_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_VIEW_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_VIEW_HPP
 
+#include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -29,6 +31,21 @@ namespace libbitcoin {
 namespace system {
 namespace chain {
 
+/// Serialized point (hash and little-endian index) referenced in place.
+using point_bytes = data_array<point::serialized_size()>;
+
+/// The index is combined as the lower entropy value, as with point.
+struct point_bytes_hash
+{
+    size_t operator()(const point_bytes& point) const NOEXCEPT
+    {
+        return hash_combine(unique_hash(point), unsafe_from_little_endian<
+            uint32_t>(std::next(point.data(), hash_size)));
+    }
+};
+
+using flat_set_of_point_bytes = flat_hash_set<point_bytes, point_bytes_hash>;
+
 class BC_API transaction_view final
 {
 public:
@@ -36,8 +53,11 @@ public:
 
     /// Source must be set to a tx position within the block buffer.
     /// Source position zero must be at the first byte of the block buffer.
+    /// Hashes are left null when not hashed (block_view batches hashing).
     transaction_view(reader& source, const data_chunk& block_buffer,
-        bool coinbase, bool witness) NOEXCEPT;
+        bool coinbase, bool witness, bool hashed=true) NOEXCEPT;
+    transaction_view(slice_reader& source, const data_chunk& block_buffer,
+        bool coinbase, bool witness, bool hashed=true) NOEXCEPT;
 
     /// Serialization.
     data_chunk to_data(bool witness) const NOEXCEPT;
@@ -56,6 +76,19 @@ public:
     size_t serialized_size(bool witness) const NOEXCEPT;
     const hash_digest& hash(bool witness) const NOEXCEPT;
 
+    /// Validation (prevouts not required).
+    code check() const NOEXCEPT;
+    code check(const context& ctx) const NOEXCEPT;
+
+    /// Validation helpers, inputs are read in place from the block buffer.
+    /// Set members reference the serialized points and hashes of the buffer.
+    bool is_coinbase_shaped() const NOEXCEPT;
+    bool is_coinbase_height(size_t height) const NOEXCEPT;
+    bool is_spending(const flat_set_of_hash_cref& hashes) const NOEXCEPT;
+    void get_point_hashes(flat_set_of_hash_cref& out) const NOEXCEPT;
+    bool put_points(flat_set_of_point_bytes& out) const NOEXCEPT;
+    size_t signature_operations() const NOEXCEPT;
+
     /// Store helpers.
     size_t input_table_size(bool pruned) const NOEXCEPT;
     size_t output_table_size() const NOEXCEPT;
@@ -74,7 +107,31 @@ public:
     stream::in::fast get_outputs_stream() const NOEXCEPT;
     stream::in::fast get_witnesses_stream() const NOEXCEPT;
 
+    /// Slices (referenced in place within the block buffer).
+    data_slice get_inputs_slice() const NOEXCEPT;
+    data_slice get_outputs_slice() const NOEXCEPT;
+    data_slice get_witnesses_slice() const NOEXCEPT;
+
 private:
+    friend class block_view;
+
+    template <typename Source>
+    void parse(Source& source, const data_chunk& block_buffer, bool witness,
+        bool hashed) NOEXCEPT;
+
+    // hash messages
+    bool has_witness_hash() const NOEXCEPT;
+    sha256::message_t nominal_message() const NOEXCEPT;
+    sha256::message_t witness_message() const NOEXCEPT;
+
+    // check helpers
+    bool is_null_non_coinbase() const NOEXCEPT;
+    bool is_invalid_coinbase_size() const NOEXCEPT;
+    bool is_absolute_locked(size_t height, uint32_t timestamp,
+        uint32_t median_time_past, bool bip113) const NOEXCEPT;
+    static size_t script_signature_operations(const uint8_t* script,
+        size_t size) NOEXCEPT;
+
     // witness commitment
     static constexpr size_t reserved_pattern_size = 2;
     static constexpr size_t commitment_pattern_size = 6;
@@ -59,6 +59,7 @@ public:
     witness(stream::in::fast& stream, bool prefix) NOEXCEPT;
     witness(std::istream& stream, bool prefix) NOEXCEPT;
     witness(reader& source, bool prefix) NOEXCEPT;
+    witness(slice_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     witness(const std::string_view& mnemonic) NOEXCEPT;
@@ -74,6 +75,7 @@ public:
 
     /// Skip a witness (as if deserialized) true if not superfluous.
     static bool skip(reader& source, bool prefix) NOEXCEPT;
+    static bool skip(slice_reader& source, bool prefix) NOEXCEPT;
 
     data_chunk to_data(bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
@@ -120,14 +122,17 @@ public:
 protected:
     witness(stream::in::fast&& stream, bool prefix) NOEXCEPT;
     witness(reader&& source, bool prefix) NOEXCEPT;
+    witness(slice_reader&& source, bool prefix) NOEXCEPT;
     witness(chunk_cptrs&& stack, bool valid) NOEXCEPT;
     witness(const chunk_cptrs& stack, bool valid) NOEXCEPT;
+    witness(chunk_cptrs&& stack, bool valid, size_t size) NOEXCEPT;
     witness(const chunk_cptrs& stack, bool valid, size_t size) NOEXCEPT;
 
 private:
     // TODO: move to config serialization wrapper.
     static witness from_string(const std::string_view& mnemonic) NOEXCEPT;
-    static witness from_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static witness from_data(Source& source, bool prefix) NOEXCEPT;
 
     // Witness should be stored as shared.
     chunk_cptrs stack_;
@@ -35,10 +35,25 @@ public:
     /// AES-256 secret is always 256 bits.
     typedef data_array<bytes<256>> secret;
 
+    /// A set of blocks processed under one key schedule.
+    typedef std_vector<block> blocks;
+
     /// nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.197-upd1.pdf
     static void encrypt_ecb(block& bytes, const secret& key) NOEXCEPT;
     static void decrypt_ecb(block& bytes, const secret& key) NOEXCEPT;
 
+    /// Key is expanded once and blocks are interleaved when AES-NI is enabled.
+    static void encrypt_ecb(blocks& bytes, const secret& key) NOEXCEPT;
+    static void decrypt_ecb(blocks& bytes, const secret& key) NOEXCEPT;
+
+    /// nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-38a.pdf
+    /// Counter is incremented as a 128 bit big-endian integer for each block.
+    /// The final block may be partial, so bytes may be of any size.
+    static void encrypt_ctr(data_chunk& bytes, const block& counter,
+        const secret& key) NOEXCEPT;
+    static void decrypt_ctr(data_chunk& bytes, const block& counter,
+        const secret& key) NOEXCEPT;
+
 private:
     struct context
     {
@@ -30,5 +30,6 @@
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
 #include <bitcoin/system/crypto/secp256k1_batch.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 
 #endif
@@ -295,6 +295,33 @@ BC_API bool exchange(hash_digest& out, const ec_secret& secret,
     bool responding) NOEXCEPT;
 
 } // namespace ellswift
+
+namespace key_cache {
+
+/// Parsed public key cache (ecdsa compressed and schnorr x-only points)
+/// ---------------------------------------------------------------------------
+/// Verification of recurring keys skips parsing (a field square root for
+/// compressed points). The cache is bounded, set-associative and lock-free,
+/// and is disabled by default.
+///
+/// This and the signature and script caches are global. Lookups are thread
+/// safe, but enable and disable are not thread safe with respect to lookups,
+/// so should be called only while validation is not in progress.
+
+/// Enable with capacity for at least entries keys of each type, discarding
+/// any existing cache. Zero entries disables the cache.
+BC_API void enable(size_t entries) NOEXCEPT;
+
+/// Disable and free the cache.
+BC_API void disable() NOEXCEPT;
+
+/// True if the cache is enabled.
+BC_API bool enabled() NOEXCEPT;
+
+/// Hits, misses and entry capacity, summed over both key types.
+BC_API digest_set::statistics get_statistics() NOEXCEPT;
+
+} // namespace key_cache
 } // namespace system
 } // namespace libbitcoin
 
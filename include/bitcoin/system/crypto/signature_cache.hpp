@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace signature_cache {
+
+/// Verified signature cache (sigcache)
+/// ---------------------------------------------------------------------------
+/// A set of successfully verified (digest, point, signature) triples, so that
+/// a signature verified at pool acceptance is not verified again at block
+/// connect. Entries are commitments to the triple and type, in a
+/// salted_digest_set. Disabled by default, threading as key_cache.
+
+/// Enable with capacity for at least entries triples, discarding any existing
+/// cache. Zero entries disables the cache.
+BC_API void enable(size_t entries) NOEXCEPT;
+
+/// Disable and free the cache.
+BC_API void disable() NOEXCEPT;
+
+/// True if the cache is enabled.
+BC_API bool enabled() NOEXCEPT;
+
+/// Hits, misses and entry capacity (lookups while disabled are not counted).
+BC_API digest_set::statistics get_statistics() NOEXCEPT;
+
+/// True if the ecdsa triple was previously verified (false if disabled).
+BC_API bool has_ecdsa(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT;
+
+/// True if the schnorr triple was previously verified (false if disabled).
+BC_API bool has_schnorr(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT;
+
+/// Record a successfully verified ecdsa triple (no-op if disabled).
+BC_API void put_ecdsa(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT;
+
+/// Record a successfully verified schnorr triple (no-op if disabled).
+BC_API void put_schnorr(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT;
+
+} // namespace signature_cache
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -29,9 +29,11 @@
 #include <bitcoin/system/data/data_slice.hpp>
 #include <bitcoin/system/data/exclusive_slice.hpp>
 #include <bitcoin/system/data/external_ptr.hpp>
+#include <bitcoin/system/data/flat_hash_set.hpp>
 #include <bitcoin/system/data/iterable.hpp>
 #include <bitcoin/system/data/memory.hpp>
 #include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/data/sequence_slot.hpp>
 #include <bitcoin/system/data/string.hpp>
 
 #include <span>
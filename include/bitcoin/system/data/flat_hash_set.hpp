@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_FLAT_HASH_SET_HPP
+#define LIBBITCOIN_SYSTEM_DATA_FLAT_HASH_SET_HPP
+
+#include <functional>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Open addressing (linear probe) set of constant references to keys.
+/// Keys are neither copied nor owned and must outlive the set. Each slot holds
+/// the key pointer and its full hash, so a probe dereferences only keys of
+/// matching hash. Intended for transient membership tests over keys with
+/// uniform hash values (e.g. unique_hash of digests), sized up front.
+template <typename Type, typename Hash = std::hash<Type>,
+    typename Equal = std::equal_to<Type>>
+class flat_hash_set
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(flat_hash_set);
+
+    /// Reserves for count keys without growth.
+    inline explicit flat_hash_set(size_t count=zero) NOEXCEPT;
+
+    /// External ownership is required.
+    inline bool emplace(Type&&) = delete;
+
+    /// True if inserted, false if an equal key exists (not replaced).
+    inline bool emplace(const Type& key) NOEXCEPT;
+
+    /// True if an equal key exists.
+    inline bool contains(const Type& key) const NOEXCEPT;
+
+    /// Remove all keys, retaining capacity.
+    inline void clear() NOEXCEPT;
+
+    inline size_t size() const NOEXCEPT;
+    inline bool empty() const NOEXCEPT;
+
+private:
+    struct slot
+    {
+        const Type* key;
+        size_t hash;
+    };
+
+    static constexpr size_t minimum_slots = 16;
+    static inline size_t to_slots(size_t count) NOEXCEPT;
+
+    inline size_t find(const Type& key, size_t hash) const NOEXCEPT;
+    inline void grow() NOEXCEPT;
+
+    std::vector<slot> slots_;
+    size_t mask_;
+    size_t size_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Type, typename Hash, typename Equal>
+#define CLASS flat_hash_set<Type, Hash, Equal>
+
+#include <bitcoin/system/impl/data/flat_hash_set.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_SEQUENCE_SLOT_HPP
+#define LIBBITCOIN_SYSTEM_DATA_SEQUENCE_SLOT_HPP
+
+#include <array>
+#include <atomic>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Sequence locked (seqlock) slot of atomic words, the lock-free table entry
+/// of the verification caches (digest_set and the parsed key cache). Readers
+/// never block: a slot that is empty, being written, or rewritten during the
+/// read reads as missing. Writers never wait: a slot being written is not
+/// written. Lost writes are acceptable only because the tables are caches.
+template <size_t Words>
+class sequence_slot
+{
+public:
+    DELETE_COPY_MOVE(sequence_slot);
+
+    using words = std::array<uint64_t, Words>;
+
+    inline sequence_slot() NOEXCEPT = default;
+
+    /// True if never written.
+    inline bool empty() const NOEXCEPT;
+
+    /// False if empty, being written, or rewritten during the read.
+    inline bool read(words& out) const NOEXCEPT;
+
+    /// False if skipped because the slot is being written.
+    inline bool write(const words& value) NOEXCEPT;
+
+private:
+    std::atomic<uint32_t> sequence_{};
+    std::array<std::atomic<uint64_t>, Words> words_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#define TEMPLATE template <size_t Words>
+#define CLASS sequence_slot<Words>
+
+#include <bitcoin/system/impl/data/sequence_slot.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
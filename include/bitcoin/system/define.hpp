@@ -89,12 +89,36 @@ namespace libbitcoin
     constexpr auto have_512 = false;
 #endif
 
+#if defined(HAVE_SSE4)
+    constexpr auto have_sse4 = true;
+#else
+    constexpr auto have_sse4 = false;
+#endif
+
+#if defined(HAVE_AVX2)
+    constexpr auto have_avx2 = true;
+#else
+    constexpr auto have_avx2 = false;
+#endif
+
 #if defined(HAVE_SHA)
     constexpr auto have_sha = true;
 #else
     constexpr auto have_sha = false;
 #endif
 
+#if defined(HAVE_AES)
+    constexpr auto have_aes = true;
+#else
+    constexpr auto have_aes = false;
+#endif
+
+#if defined(HAVE_THREADED_DISPATCH)
+    constexpr auto have_threaded_dispatch = true;
+#else
+    constexpr auto have_threaded_dispatch = false;
+#endif
+
 } // namespace libbitcoin
 
 /// Create bc namespace alias.
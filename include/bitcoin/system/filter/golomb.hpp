@@ -85,6 +85,21 @@ public:
         const siphash_key& entropy, uint8_t bits,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    /// Multiple element match
+    /// -----------------------------------------------------------------------
+    /// The compressed set excludes its leading set size, and is decoded once
+    /// (a word at a time) against the sorted set of hashed targets.
+
+    static bool match_many(const data_slice& compressed_set,
+        const data_stack& targets, uint64_t set_size,
+        const siphash_key& entropy, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
+    static bool match_many(const data_slice& compressed_set,
+        const data_stack& targets, uint64_t set_size,
+        const half_hash& entropy, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
 private:
     static void encode(bitwriter& writer, uint64_t value,
         uint8_t modulo_exponent) NOEXCEPT;
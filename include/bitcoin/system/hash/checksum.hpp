@@ -87,6 +87,21 @@ BC_API bool bech32_verify_checked(uint8_t& out_version,
     data_chunk& out_program, const std::string& prefix,
     const base32_chunk& checked) NOEXCEPT;
 
+/// Encode each version and program as [prefix][1][checked base32 payload].
+/// The prefix is lowered and its checksum contribution computed once. An
+/// element is empty if its version is above 5 bits. Empty if the sizes of
+/// versions and programs differ.
+BC_API string_list bech32_encode_many(const std::string& prefix,
+    const data_chunk& versions, const data_stack& programs) NOEXCEPT;
+
+/// Verify and extract the version and program of each address, as encoded
+/// by bech32_encode_many. Addresses may be all upper or all lower case.
+/// False (and outputs cleared) if any address has a mismatched prefix,
+/// invalid character, invalid checksum or nonzero padding.
+BC_API bool bech32_decode_many(data_chunk& out_versions,
+    data_stack& out_programs, const std::string& prefix,
+    const string_list& addresses) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
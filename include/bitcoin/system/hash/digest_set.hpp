@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_DIGEST_SET_HPP
+#define LIBBITCOIN_SYSTEM_HASH_DIGEST_SET_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <bitcoin/system/data/sequence_slot.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/accumulator.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/hash/functions.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed-memory, lock-free, bucketized cuckoo set of uniformly distributed
+/// digests, such as salted hash commitments. The digest is its own bucket
+/// hash, so digests must not be attacker-controlled (i.e. must be salted).
+/// Slots are sequence locked (see sequence_slot). Insertion takes an empty
+/// way of either bucket, else displaces one victim to an empty way of its
+/// alternate bucket, else overwrites the victim. Any entry may be lost, so the
+/// set is suitable only as a cache.
+class BC_API digest_set
+{
+public:
+    DELETE_COPY_MOVE(digest_set);
+
+    /// Also reported by the key, signature and script caches.
+    struct statistics
+    {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t capacity;
+    };
+
+    /// Allocate capacity for at least the given number of entries.
+    digest_set(size_t entries) NOEXCEPT;
+
+    /// True if the digest is in the set (counted as hit or miss).
+    bool contains(const hash_digest& digest) NOEXCEPT;
+
+    /// Add the digest to the set, possibly displacing another.
+    void insert(const hash_digest& digest) NOEXCEPT;
+
+    /// Number of entry slots.
+    size_t capacity() const NOEXCEPT;
+
+    /// Hits and misses of contains(), and capacity().
+    statistics get_statistics() const NOEXCEPT;
+
+private:
+    static constexpr size_t ways = 4;
+    static constexpr size_t shards = 16;
+    using slot = sequence_slot<hash_size / sizeof(uint64_t)>;
+    using entry = slot::words;
+
+    // Counters are sharded to avoid a contended cache line.
+    struct alignas(64) counter
+    {
+        std::atomic<uint64_t> hits{};
+        std::atomic<uint64_t> misses{};
+    };
+
+    static entry to_entry(const hash_digest& digest) NOEXCEPT;
+
+    size_t first(const entry& value) const NOEXCEPT;
+    size_t second(const entry& value) const NOEXCEPT;
+    slot& slot_at(size_t bucket, size_t way) NOEXCEPT;
+    size_t vacancy(size_t bucket) NOEXCEPT;
+    bool find(size_t bucket, const entry& value) NOEXCEPT;
+
+    const size_t mask_;
+    std::vector<slot> slots_;
+    std::array<counter, shards> counters_{};
+};
+
+/// Switchable digest_set of sha256 commitments salted with a random 64 byte
+/// block, as used by the signature and script caches. The salt fills the
+/// first block, so the salted midstate is reused. The caller commits to its
+/// entry by writing to context() and flushing. Lookups are thread safe, but
+/// enable and disable are not thread safe with respect to lookups.
+class BC_API salted_digest_set
+{
+public:
+    DELETE_COPY_MOVE(salted_digest_set);
+
+    /// Construct disabled.
+    salted_digest_set() NOEXCEPT;
+
+    /// Enable with capacity for at least entries, discarding any existing set
+    /// and salt. Zero entries disables the set.
+    void enable(size_t entries) NOEXCEPT;
+
+    /// Disable and free the set.
+    void disable() NOEXCEPT;
+
+    /// True if the set is enabled.
+    bool enabled() const NOEXCEPT;
+
+    /// Statistics of the set (zeroed if disabled).
+    digest_set::statistics get_statistics() const NOEXCEPT;
+
+    /// Copy of the salted hash context, for computing a commitment.
+    accumulator<sha256> context() const NOEXCEPT;
+
+    /// True if the commitment is in the set (false if disabled).
+    bool contains(const hash_digest& commitment) NOEXCEPT;
+
+    /// Add the commitment to the set (no-op if disabled).
+    void insert(const hash_digest& commitment) NOEXCEPT;
+
+private:
+    std::unique_ptr<digest_set> set_{};
+    accumulator<sha256> salted_{};
+    std::atomic_bool enabled_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -64,6 +64,7 @@ typedef std::shared_ptr<const mini_hash> mini_hash_cptr;
 
 /// Hashes are not pmr types, preserves constexpr.
 typedef std::vector<hash_digest> hashes;
+typedef std::vector<short_hash> short_hashes;
 
 /// Null-valued common hashes.
 constexpr long_hash null_long_hash{};
@@ -88,18 +89,21 @@ INLINE data_chunk rmd128_chunk(const Type& data) NOEXCEPT;
 /// rmd160 [script].
 template <typename Type>
 INLINE short_hash rmd160_hash(const Type& data) NOEXCEPT;
+INLINE short_hash rmd160_hash(size_t size, const uint8_t* data) NOEXCEPT;
 template <typename Type>
 INLINE data_chunk rmd160_chunk(const Type& data) NOEXCEPT;
 
 /// sha1 (sha160) [script].
 template <typename Type>
 INLINE short_hash sha1_hash(const Type& data) NOEXCEPT;
+INLINE short_hash sha1_hash(size_t size, const uint8_t* data) NOEXCEPT;
 template <typename Type>
 INLINE data_chunk sha1_chunk(const Type& data) NOEXCEPT;
 
 /// sha256 [script, wallet].
 template <typename Type>
 INLINE hash_digest sha256_hash(const Type& data) NOEXCEPT;
+INLINE hash_digest sha256_hash(size_t size, const uint8_t* data) NOEXCEPT;
 INLINE hash_digest sha256_hash(const hash_digest& left,
     const hash_digest& right) NOEXCEPT;
 INLINE hash_digest sha256_hash2(const data_slice& left,
@@ -119,9 +123,13 @@ INLINE data_chunk sha512_chunk(const Type& data) NOEXCEPT;
 /// Bitcoin short hash (rmd160(sha256)) [script].
 template <typename Type>
 INLINE short_hash bitcoin_short_hash(const Type& data) NOEXCEPT;
+INLINE short_hash bitcoin_short_hash(size_t size, const uint8_t* data) NOEXCEPT;
 template <typename Type>
 INLINE data_chunk bitcoin_short_chunk(const Type& data) NOEXCEPT;
 
+/// Bitcoin short hash of each element of a set (rmd160 vectorized) [index].
+INLINE short_hashes bitcoin_short_hashes(const data_stack& set) NOEXCEPT;
+
 /// Bitcoin hash (sha256(sha256)) [script, chain, wallet].
 template <typename Type>
 INLINE hash_digest bitcoin_hash(const Type& data) NOEXCEPT;
@@ -164,6 +172,7 @@ INLINE constexpr size_t hash_combine(size_t left, size_t right) NOEXCEPT;
 /// Constant reference optimizers.
 using hash_cref = std::reference_wrapper<const hash_digest>;
 using unordered_set_of_hash_cref = std::unordered_set<hash_cref>;
+using flat_set_of_hash_cref = flat_hash_set<hash_digest, unique_hash_t<>>;
 
 } // namespace system
 } // namespace libbitcoin
@@ -24,6 +24,7 @@
 #include <bitcoin/system/hash/algorithm.hpp>
 #include <bitcoin/system/hash/algorithms.hpp>
 #include <bitcoin/system/hash/checksum.hpp>
+#include <bitcoin/system/hash/digest_set.hpp>
 #include <bitcoin/system/hash/functions.hpp>
 #include <bitcoin/system/hash/hkdf.hpp>
 #include <bitcoin/system/hash/hmac.hpp>
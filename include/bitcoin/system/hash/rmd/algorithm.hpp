@@ -23,6 +23,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/hash/algorithm.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 // algorithm.hpp file is the common include for rmd.
@@ -39,7 +40,9 @@ namespace system {
 namespace rmd {
 
 /// RMD hashing algorithm.
-template <typename RMD, if_same<typename RMD::T, rmdh_t> = true>
+/// Vectorization of independent half block hashes (e.g. hash160 batches).
+template <typename RMD, bool Vector = true,
+    if_same<typename RMD::T, rmdh_t> = true>
 class algorithm
   : algorithm_t
 {
@@ -64,10 +67,12 @@ public:
     using block_t   = std_array<byte_t, RMD::block_words * RMD::word_bytes>;
     using digest_t  = std_array<byte_t, bytes<RMD::digest>>;
 
-    /// Block collection types.
+    /// Collection types.
     template <size_t Size>
     using ablocks_t = std_array<block_t, Size>;
     using iblocks_t = iterable<block_t>;
+    using halves_t  = std::vector<half_t>;
+    using digests_t = std::vector<digest_t>;
 
     /// Constants (and count_t).
     /// -----------------------------------------------------------------------
@@ -90,6 +95,10 @@ public:
     static constexpr digest_t hash(const half_t& half) NOEXCEPT;
     static digest_t hash(iblocks_t&& blocks) NOEXCEPT;
 
+    /// Hash each half block independently, vectorized across lanes (as
+    /// available). This is the rmd160 step of a set of bitcoin_short_hash.
+    static digests_t hash(const halves_t& halves) NOEXCEPT;
+
     /// Streamed hashing (unfinalized).
     /// -----------------------------------------------------------------------
 
@@ -103,6 +112,41 @@ public:
     static constexpr digest_t normalize(const state_t& state) NOEXCEPT;
 
 protected:
+    /// Intrinsics constants.
+    /// -----------------------------------------------------------------------
+
+    static constexpr auto use_128 = Vector && bc::have_128;
+    static constexpr auto use_256 = Vector && bc::have_256;
+    static constexpr auto use_512 = Vector && bc::have_512;
+
+    template <size_t Lanes>
+    static constexpr auto is_valid_lanes =
+        (Lanes == 16u || Lanes == 8u || Lanes == 4u);
+
+    static constexpr auto min_lanes =
+        (use_128 ? bytes<128> :
+            (use_256 ? bytes<256> :
+                (use_512 ? bytes<512> : 0))) / RMD::word_bytes;
+
+    /// Intrinsics types.
+    /// -----------------------------------------------------------------------
+
+    /// Multiple half blocks are "striped" across the expanded words in xWords.
+    template <size_t Lanes, bool_if<is_valid_lanes<Lanes>> = true>
+    using xchunk_t = std_array<chunk_t, Lanes>;
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xwords_t = std_array<xWord, RMD::block_words>;
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xstate_t = std_array<xWord, RMD::state_words>;
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xpad_t = std_array<xWord, RMD::chunk_words>;
+
+    using ihalves_t = iterable<half_t>;
+    using idigests_t = mutable_iterable<digest_t>;
+
     /// Functions
     /// -----------------------------------------------------------------------
     
@@ -128,10 +172,11 @@ protected:
 
     template<size_t Round>
     INLINE static constexpr void round(auto& state, const auto& words) NOEXCEPT;
-    INLINE static constexpr void summarize(state_t& out, const state_t& batch1,
-        const state_t& batch2) NOEXCEPT;
+    INLINE static constexpr void summarize(auto& out, const auto& batch1,
+        const auto& batch2) NOEXCEPT;
+    static constexpr void compress_(auto& state, const auto& words) NOEXCEPT;
     static constexpr void compress(state_t& state, const words_t& words) NOEXCEPT;
-    
+
     /// Parsing
     /// -----------------------------------------------------------------------
     INLINE static constexpr void input(words_t& words, const block_t& block) NOEXCEPT;
@@ -144,6 +189,35 @@ protected:
     static constexpr void pad_half(words_t& words) NOEXCEPT;
     static constexpr void pad_n(words_t& words, count_t blocks) NOEXCEPT;
 
+    /// Vectorization (independent half blocks across lanes).
+    /// -----------------------------------------------------------------------
+
+    template <size_t Word, size_t Lanes>
+    INLINE static auto pack(const xchunk_t<Lanes>& xchunk) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static auto pack(const state_t& state) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static auto pack_pad_half() NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xinput(xwords_t<xWord>& xwords,
+        ihalves_t& halves) NOEXCEPT;
+
+    template <size_t Lane, typename xWord>
+    INLINE static digest_t unpack(const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xoutput(idigests_t& digests,
+        const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void hash_vector(idigests_t& digests,
+        ihalves_t& halves) NOEXCEPT;
+    INLINE static size_t hash_vector(digests_t& digests,
+        const halves_t& halves) NOEXCEPT;
+
 private:
     using pad_t = std_array<word_t, subtract(RMD::block_words,
         count_bytes / RMD::word_bytes)>;
@@ -151,14 +225,20 @@ private:
     static consteval words_t block_pad() NOEXCEPT;
     static consteval chunk_t chunk_pad() NOEXCEPT;
     static consteval pad_t stream_pad() NOEXCEPT;
+
+public:
+    /// Summary public values.
+    /// -----------------------------------------------------------------------
+    static constexpr auto vector = (use_128 || use_256 || use_512);
 };
 
 } // namespace rmd
 } // namespace system
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename RMD, if_same<typename RMD::T, rmdh_t> If>
-#define CLASS algorithm<RMD, If>
+#define TEMPLATE template <typename RMD, bool Vector, \
+    if_same<typename RMD::T, rmdh_t> If>
+#define CLASS algorithm<RMD, Vector, If>
 
 #include <bitcoin/system/impl/hash/rmd/algorithm.ipp>
 
@@ -97,6 +97,10 @@ public:
     using iblocks_t = iterable<block_t>;
     using digests_t = std::vector<digest_t>;
 
+    /// A message is the concatenation of up to three (discontiguous) slices.
+    using message_t  = std_array<data_slice, 3>;
+    using messages_t = std::vector<message_t>;
+
     /// Count types.
     /// -----------------------------------------------------------------------
 
@@ -130,6 +134,9 @@ public:
     template <size_t Size, if_not_greater<Size, CLASSIF::space> = true>
     static constexpr digest_t simple_hash(const bytes_t<Size>& bytes) NOEXCEPT;
 
+    /// Hash each message independently, vectorized across messages.
+    static digests_t hash(const messages_t& messages) NOEXCEPT;
+
     /// Same as hash but returns state_t instead of converting it to digest_t.
     static constexpr state_t midstate(const half_t& left,
         const half_t& right) NOEXCEPT;
@@ -144,6 +151,9 @@ public:
     static constexpr digest_t double_hash(const half_t& left, const half_t& right) NOEXCEPT;
     static digest_t double_hash(iblocks_t&& blocks) NOEXCEPT;
 
+    /// Double hash each message independently, vectorized across messages.
+    static digests_t double_hash(const messages_t& messages) NOEXCEPT;
+
     /// Streamed hashing (explicitly finalized).
     /// -----------------------------------------------------------------------
     static void accumulate(state_t& state, iblocks_t&& blocks) NOEXCEPT;
@@ -379,6 +389,31 @@ protected:
     constexpr static void merkle_hash_(digests_t& digests,
         size_t offset=zero) NOEXCEPT;
 
+    /// Message hashing (fully vectorized for multiple messages).
+    /// -----------------------------------------------------------------------
+
+    using sizes_t = std::vector<size_t>;
+
+    static constexpr size_t message_blocks(size_t size) NOEXCEPT;
+    static void message_block(block_t& block, const message_t& message,
+        size_t size, size_t index) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static auto xmask(const size_t* group, const sizes_t& blocks,
+        size_t block) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xscatter(digests_t& digests, const size_t* group,
+        const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <bool Double, typename xWord, if_extended<xWord> = true>
+    INLINE static void messages_vector(digests_t& digests,
+        const messages_t& messages, const sizes_t& sizes,
+        const sizes_t& blocks, const sizes_t& order, size_t& next) NOEXCEPT;
+
+    template <bool Double>
+    static digests_t messages_hash(const messages_t& messages) NOEXCEPT;
+
     /// sigma0 vectorization (single blocks).
     /// -----------------------------------------------------------------------
 
@@ -483,6 +518,7 @@ BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 #include <bitcoin/system/impl/hash/sha/algorithm_functions.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_iterate.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_merkle.ipp>
+#include <bitcoin/system/impl/hash/sha/algorithm_messages.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_midstate.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_native.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_padding.ipp>
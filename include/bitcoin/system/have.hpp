@@ -98,6 +98,11 @@
     #endif
 #endif
 
+/// vc++: There are no flags for AES-NI, so use custom WITH_AES option.
+#if defined(HAVE_MSC) && defined(WITH_AES) && defined(HAVE_XCPU)
+    #define __AES__
+#endif
+
 // Custom options to use extended SVE variable width.
 #if defined(__ARM_FEATURE_SVE)
     #if defined(WITH_512)
@@ -113,6 +118,11 @@
     #define HAVE_ULTRAFAST
 #endif
 
+// Custom option to default the interpreter to pre-decoded (threaded) dispatch.
+#if defined(WITH_THREADED_DISPATCH)
+    #define HAVE_THREADED_DISPATCH
+#endif
+
 /// Platform features derived.
 /// ---------------------------------------------------------------------------
 
@@ -155,6 +165,12 @@
         #define HAVE_SHANI
         #define HAVE_SHA
     #endif
+    // -maes
+    // vc++: AES-NI not independently configurable (requires custom option).
+    #if defined(__AES__) && defined(__SSE4_1__)
+        #define HAVE_AESNI
+        #define HAVE_AES
+    #endif
     // -mavx512bw
     // vc++: Advanced Vector Extensions 512 (X86/X64) (/arch:AVX512)
     #if defined(__AVX512BW__)
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_OPERATION_PATTERNS_IPP
 #define LIBBITCOIN_SYSTEM_CHAIN_OPERATION_PATTERNS_IPP
 
+#include <string_view>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/chain/enums/numbers.hpp>
 #include <bitcoin/system/chain/enums/opcode.hpp>
@@ -68,6 +69,26 @@ constexpr size_t operation::opcode_to_maximum_size(opcode code) NOEXCEPT
     }
 }
 
+// Text size prefix of a push, empty if the opcode is minimal for the size.
+constexpr std::string_view operation::opcode_to_prefix(opcode code,
+    size_t size) NOEXCEPT
+{
+    if (code == opcode_from_size(size))
+        return {};
+
+    switch (code)
+    {
+        case opcode::push_one_size:
+            return "1.";
+        case opcode::push_two_size:
+            return "2.";
+        case opcode::push_four_size:
+            return "4.";
+        default:
+            return "0.";
+    }
+}
+
 // Compute nominal data opcode based on size alone.
 // ****************************************************************************
 // CONSENSUS: non-minial encoding consensus critical for find_and_delete.
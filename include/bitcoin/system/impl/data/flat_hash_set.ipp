@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_FLAT_HASH_SET_IPP
+#define LIBBITCOIN_SYSTEM_DATA_FLAT_HASH_SET_IPP
+
+#include <algorithm>
+#include <bit>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Load factor is held at or below one half, so probe sequences remain short
+// and there is always an empty slot to terminate a probe.
+TEMPLATE
+inline size_t CLASS::
+to_slots(size_t count) NOEXCEPT
+{
+    return std::bit_ceil(std::max(ceilinged_multiply(count, two),
+        minimum_slots));
+}
+
+TEMPLATE
+inline CLASS::
+flat_hash_set(size_t count) NOEXCEPT
+  : slots_(to_slots(count), slot{}),
+    mask_(sub1(slots_.size())),
+    size_(zero)
+{
+}
+
+TEMPLATE
+inline size_t CLASS::
+find(const Type& key, size_t hash) const NOEXCEPT
+{
+    constexpr Equal equal{};
+    auto index = bit_and(hash, mask_);
+    for (; !is_null(slots_[index].key); index = bit_and(add1(index), mask_))
+    {
+        const auto& at = slots_[index];
+        if (at.hash == hash && equal(*at.key, key))
+            break;
+    }
+
+    return index;
+}
+
+TEMPLATE
+inline bool CLASS::
+emplace(const Type& key) NOEXCEPT
+{
+    if (ceilinged_multiply(add1(size_), two) > slots_.size())
+        grow();
+
+    const auto hash = Hash{}(key);
+    auto& at = slots_[find(key, hash)];
+    if (!is_null(at.key))
+        return false;
+
+    at = { &key, hash };
+    ++size_;
+    return true;
+}
+
+TEMPLATE
+inline bool CLASS::
+contains(const Type& key) const NOEXCEPT
+{
+    return !is_null(slots_[find(key, Hash{}(key))].key);
+}
+
+TEMPLATE
+inline void CLASS::
+clear() NOEXCEPT
+{
+    std::fill(slots_.begin(), slots_.end(), slot{});
+    size_ = zero;
+}
+
+TEMPLATE
+inline size_t CLASS::
+size() const NOEXCEPT
+{
+    return size_;
+}
+
+TEMPLATE
+inline bool CLASS::
+empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+// private
+TEMPLATE
+inline void CLASS::
+grow() NOEXCEPT
+{
+    std::vector<slot> prior(to_slots(slots_.size()), slot{});
+    std::swap(prior, slots_);
+    mask_ = sub1(slots_.size());
+
+    // Hashes are retained, so keys are neither rehashed nor compared.
+    for (const auto& from: prior)
+    {
+        if (is_null(from.key))
+            continue;
+
+        auto index = bit_and(from.hash, mask_);
+        while (!is_null(slots_[index].key))
+            index = bit_and(add1(index), mask_);
+
+        slots_[index] = from;
+    }
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_SEQUENCE_SLOT_IPP
+#define LIBBITCOIN_SYSTEM_DATA_SEQUENCE_SLOT_IPP
+
+#include <atomic>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+TEMPLATE
+inline bool CLASS::
+empty() const NOEXCEPT
+{
+    return is_zero(sequence_.load(std::memory_order_relaxed));
+}
+
+TEMPLATE
+inline bool CLASS::
+read(words& out) const NOEXCEPT
+{
+    const auto sequence = sequence_.load(std::memory_order_acquire);
+    if (is_zero(sequence) || is_odd(sequence))
+        return false;
+
+    for (size_t word{}; word < Words; ++word)
+        out[word] = words_[word].load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence_.load(std::memory_order_relaxed) == sequence;
+}
+
+TEMPLATE
+inline bool CLASS::
+write(const words& value) NOEXCEPT
+{
+    auto sequence = sequence_.load(std::memory_order_relaxed);
+    if (is_odd(sequence) || !sequence_.compare_exchange_strong(sequence,
+        add1(sequence), std::memory_order_acquire, std::memory_order_relaxed))
+        return false;
+
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t word{}; word < Words; ++word)
+        words_[word].store(value[word], std::memory_order_relaxed);
+
+    sequence_.store(sequence + two, std::memory_order_release);
+    return true;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_HASH_IPP
 #define LIBBITCOIN_SYSTEM_HASH_HASH_IPP
 
+#include <algorithm>
 #include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -69,6 +70,11 @@ INLINE short_hash rmd160_hash(const Type& data) NOEXCEPT
     return accumulator<rmd160>::hash(data);
 }
 
+INLINE short_hash rmd160_hash(size_t size, const uint8_t* data) NOEXCEPT
+{
+    return accumulator<rmd160>::hash(size, data);
+}
+
 template <typename Type>
 INLINE data_chunk rmd160_chunk(const Type& data) NOEXCEPT
 {
@@ -82,6 +88,11 @@ INLINE short_hash sha1_hash(const Type& data) NOEXCEPT
     return accumulator<sha160>::hash(data);
 }
 
+INLINE short_hash sha1_hash(size_t size, const uint8_t* data) NOEXCEPT
+{
+    return accumulator<sha160>::hash(size, data);
+}
+
 template <typename Type>
 INLINE data_chunk sha1_chunk(const Type& data) NOEXCEPT
 {
@@ -95,6 +106,11 @@ INLINE hash_digest sha256_hash(const Type& data) NOEXCEPT
     return accumulator<sha256>::hash(data);
 }
 
+INLINE hash_digest sha256_hash(size_t size, const uint8_t* data) NOEXCEPT
+{
+    return accumulator<sha256>::hash(size, data);
+}
+
 INLINE hash_digest sha256_hash(const hash_digest& left,
     const hash_digest& right) NOEXCEPT
 {
@@ -141,12 +157,30 @@ INLINE short_hash bitcoin_short_hash(const Type& data) NOEXCEPT
     return rmd160::hash(accumulator<sha256>::hash(data));
 }
 
+INLINE short_hash bitcoin_short_hash(size_t size, const uint8_t* data) NOEXCEPT
+{
+    return rmd160::hash(accumulator<sha256>::hash(size, data));
+}
+
 template <typename Type>
 INLINE data_chunk bitcoin_short_chunk(const Type& data) NOEXCEPT
 {
     return accumulator<rmd160>::hash_chunk(accumulator<sha256>::hash(data));
 }
 
+INLINE short_hashes bitcoin_short_hashes(const data_stack& set) NOEXCEPT
+{
+    // sha256 digests are contiguous half blocks, both hashed in lanes.
+    sha256::messages_t messages(set.size());
+    std::transform(set.begin(), set.end(), messages.begin(),
+        [](const data_chunk& data) NOEXCEPT
+        {
+            return sha256::message_t{ data };
+        });
+
+    return rmd160::hash(sha256::hash(messages));
+}
+
 // Bitcoin hash (sha256(sha256)) [script, chain, wallet].
 template <typename Type>
 INLINE hash_digest bitcoin_hash(const Type& data) NOEXCEPT
@@ -112,11 +112,12 @@ template<size_t Round>
 INLINE constexpr auto CLASS::
 round(auto& a, auto b, auto c, auto d, auto x) NOEXCEPT
 {
+    constexpr auto w = RMD::word_bits;
     constexpr auto s = K::rot[Round];
     constexpr auto k = K::get[Round / K::columns];
     constexpr auto fn = functor<Round, decltype(a)>();
 
-    a = /*b =*/ f::rol<s>(f::addc<k>(f::add(f::add(a, fn(b, c, d)), x)));
+    a = /*b =*/ f::rol<s, w>(f::addc<k, w>(f::add<w>(f::add<w>(a, fn(b, c, d)), x)));
 }
 
 TEMPLATE
@@ -124,12 +125,13 @@ template<size_t Round>
 INLINE constexpr auto CLASS::
 round(auto& a, auto b, auto& c, auto d, auto e, auto x) NOEXCEPT
 {
+    constexpr auto w = RMD::word_bits;
     constexpr auto s = K::rot[Round];
     constexpr auto k = K::get[Round / K::columns];
     constexpr auto fn = functor<Round, decltype(a)>();
 
-    a = /*b =*/ f::add(f::rol<s>(f::addc<k>(f::add(f::add(a, fn(b, c, d)), x))), e);
-    c = /*d =*/ f::rol<10>(c);
+    a = /*b =*/ f::add<w>(f::rol<s, w>(f::addc<k, w>(f::add<w>(f::add<w>(a, fn(b, c, d)), x))), e);
+    c = /*d =*/ f::rol<10, w>(c);
 }
 
 TEMPLATE
@@ -160,12 +162,13 @@ round(auto& state, const auto& words) NOEXCEPT
 
 TEMPLATE
 constexpr void CLASS::
-compress(state_t& state, const words_t& words) NOEXCEPT
+compress_(auto& state, const auto& words) NOEXCEPT
 {
     constexpr auto offset = to_half(RMD::rounds);
 
-    state_t left{ state };
-    state_t right{ state };
+    // These are copies (state type varies due to vectorization).
+    auto left = state;
+    auto right = state;
 
     // RMD160:f0/f4, RMD128:f0/f3
     round< 0>(left, words); round< 0 + offset>(right, words);
@@ -263,27 +266,35 @@ compress(state_t& state, const words_t& words) NOEXCEPT
     summarize(state, left, right);
 }
 
+TEMPLATE
+constexpr void CLASS::
+compress(state_t& state, const words_t& words) NOEXCEPT
+{
+    compress_(state, words);
+}
+
 TEMPLATE
 INLINE constexpr void CLASS::
-summarize(state_t& state, const state_t& batch1,
-    const state_t& batch2) NOEXCEPT
+summarize(auto& state, const auto& batch1, const auto& batch2) NOEXCEPT
 {
+    constexpr auto w = RMD::word_bits;
+
     if constexpr (RMD::strength == 128)
     {
         const auto state_0_ = state[0];
-        state[0] = f::add(f::add(state[1], batch1[2]), batch2[3]);
-        state[1] = f::add(f::add(state[2], batch1[3]), batch2[0]);
-        state[2] = f::add(f::add(state[3], batch1[0]), batch2[1]);
-        state[3] = f::add(f::add(state_0_, batch1[1]), batch2[2]);
+        state[0] = f::add<w>(f::add<w>(state[1], batch1[2]), batch2[3]);
+        state[1] = f::add<w>(f::add<w>(state[2], batch1[3]), batch2[0]);
+        state[2] = f::add<w>(f::add<w>(state[3], batch1[0]), batch2[1]);
+        state[3] = f::add<w>(f::add<w>(state_0_, batch1[1]), batch2[2]);
     }
     else
     {
         const auto state_0_ = state[0];
-        state[0] = f::add(f::add(state[1], batch1[2]), batch2[3]);
-        state[1] = f::add(f::add(state[2], batch1[3]), batch2[4]);
-        state[2] = f::add(f::add(state[3], batch1[4]), batch2[0]);
-        state[3] = f::add(f::add(state[4], batch1[0]), batch2[1]);
-        state[4] = f::add(f::add(state_0_, batch1[1]), batch2[2]);
+        state[0] = f::add<w>(f::add<w>(state[1], batch1[2]), batch2[3]);
+        state[1] = f::add<w>(f::add<w>(state[2], batch1[3]), batch2[4]);
+        state[2] = f::add<w>(f::add<w>(state[3], batch1[4]), batch2[0]);
+        state[3] = f::add<w>(f::add<w>(state[4], batch1[0]), batch2[1]);
+        state[4] = f::add<w>(f::add<w>(state_0_, batch1[1]), batch2[2]);
     }
 }
 
@@ -595,6 +606,272 @@ hash(const half_t& half) NOEXCEPT
     return output(state);
 }
 
+// Vectorization (independent half blocks across lanes).
+// ---------------------------------------------------------------------------
+// rmd is little-endian, as are all vectorized platforms, so no byteswap.
+
+TEMPLATE
+template <size_t Word, size_t Lanes>
+INLINE auto CLASS::
+pack(const xchunk_t<Lanes>& xchunk) NOEXCEPT
+{
+    using xword_t = to_extended<word_t, Lanes>;
+
+    if constexpr (Lanes == 4)
+    {
+        return f::set<xword_t>(
+            xchunk[0][Word],
+            xchunk[1][Word],
+            xchunk[2][Word],
+            xchunk[3][Word]);
+    }
+    else if constexpr (Lanes == 8)
+    {
+        return f::set<xword_t>(
+            xchunk[0][Word],
+            xchunk[1][Word],
+            xchunk[2][Word],
+            xchunk[3][Word],
+            xchunk[4][Word],
+            xchunk[5][Word],
+            xchunk[6][Word],
+            xchunk[7][Word]);
+    }
+    else if constexpr (Lanes == 16)
+    {
+        return f::set<xword_t>(
+            xchunk[ 0][Word],
+            xchunk[ 1][Word],
+            xchunk[ 2][Word],
+            xchunk[ 3][Word],
+            xchunk[ 4][Word],
+            xchunk[ 5][Word],
+            xchunk[ 6][Word],
+            xchunk[ 7][Word],
+            xchunk[ 8][Word],
+            xchunk[ 9][Word],
+            xchunk[10][Word],
+            xchunk[11][Word],
+            xchunk[12][Word],
+            xchunk[13][Word],
+            xchunk[14][Word],
+            xchunk[15][Word]);
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE auto CLASS::
+pack(const state_t& state) NOEXCEPT
+{
+    if constexpr (RMD::strength == 128)
+    {
+        return xstate_t<xWord>
+        {
+            f::broadcast<xWord>(state[0]),
+            f::broadcast<xWord>(state[1]),
+            f::broadcast<xWord>(state[2]),
+            f::broadcast<xWord>(state[3])
+        };
+    }
+    else
+    {
+        return xstate_t<xWord>
+        {
+            f::broadcast<xWord>(state[0]),
+            f::broadcast<xWord>(state[1]),
+            f::broadcast<xWord>(state[2]),
+            f::broadcast<xWord>(state[3]),
+            f::broadcast<xWord>(state[4])
+        };
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE auto CLASS::
+pack_pad_half() NOEXCEPT
+{
+    constexpr auto pad = chunk_pad();
+
+    return xpad_t<xWord>
+    {
+        f::broadcast<xWord>(pad[0]),
+        f::broadcast<xWord>(pad[1]),
+        f::broadcast<xWord>(pad[2]),
+        f::broadcast<xWord>(pad[3]),
+        f::broadcast<xWord>(pad[4]),
+        f::broadcast<xWord>(pad[5]),
+        f::broadcast<xWord>(pad[6]),
+        f::broadcast<xWord>(pad[7])
+    };
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xinput(xwords_t<xWord>& xwords, ihalves_t& halves) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    const auto& xchunk = array_cast<chunk_t>(halves.template to_array<lanes>());
+    xwords[0] = pack<0>(xchunk);
+    xwords[1] = pack<1>(xchunk);
+    xwords[2] = pack<2>(xchunk);
+    xwords[3] = pack<3>(xchunk);
+    xwords[4] = pack<4>(xchunk);
+    xwords[5] = pack<5>(xchunk);
+    xwords[6] = pack<6>(xchunk);
+    xwords[7] = pack<7>(xchunk);
+    halves.template advance<lanes>();
+}
+
+TEMPLATE
+template <size_t Lane, typename xWord>
+INLINE typename CLASS::digest_t CLASS::
+unpack(const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    if constexpr (RMD::strength == 128)
+    {
+        return output(state_t
+        {
+            f::get<word_t, Lane>(xstate[0]),
+            f::get<word_t, Lane>(xstate[1]),
+            f::get<word_t, Lane>(xstate[2]),
+            f::get<word_t, Lane>(xstate[3])
+        });
+    }
+    else
+    {
+        return output(state_t
+        {
+            f::get<word_t, Lane>(xstate[0]),
+            f::get<word_t, Lane>(xstate[1]),
+            f::get<word_t, Lane>(xstate[2]),
+            f::get<word_t, Lane>(xstate[3]),
+            f::get<word_t, Lane>(xstate[4])
+        });
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xoutput(idigests_t& digests, const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    BC_ASSERT(digests.size() >= lanes);
+
+    auto& xdigest = array_cast<digest_t>(digests.template to_array<lanes>());
+
+    xdigest[0] = unpack<0>(xstate);
+    xdigest[1] = unpack<1>(xstate);
+    xdigest[2] = unpack<2>(xstate);
+    xdigest[3] = unpack<3>(xstate);
+
+    if constexpr (lanes >= 8)
+    {
+        xdigest[4] = unpack<4>(xstate);
+        xdigest[5] = unpack<5>(xstate);
+        xdigest[6] = unpack<6>(xstate);
+        xdigest[7] = unpack<7>(xstate);
+    }
+
+    if constexpr (lanes >= 16)
+    {
+        xdigest[8] = unpack<8>(xstate);
+        xdigest[9] = unpack<9>(xstate);
+        xdigest[10] = unpack<10>(xstate);
+        xdigest[11] = unpack<11>(xstate);
+        xdigest[12] = unpack<12>(xstate);
+        xdigest[13] = unpack<13>(xstate);
+        xdigest[14] = unpack<14>(xstate);
+        xdigest[15] = unpack<15>(xstate);
+    }
+
+    digests.template advance<lanes>();
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+hash_vector(idigests_t& digests, ihalves_t& halves) NOEXCEPT
+{
+    BC_ASSERT(digests.size() == halves.size());
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>)
+    {
+        if (halves.size() >= lanes)
+        {
+            static const auto initial = pack<xWord>(H::get);
+            static const auto xpad = pack_pad_half<xWord>();
+
+            // Padding of the right half is invariant across all lanes.
+            xwords_t<xWord> xwords{};
+            array_cast<xWord, RMD::chunk_words, RMD::chunk_words>(xwords) = xpad;
+
+            do
+            {
+                auto xstate = initial;
+
+                // xinput() advances half iterator by lanes.
+                xinput(xwords, halves);
+                compress_(xstate, xwords);
+
+                // xoutput() advances digest iterator by lanes.
+                xoutput(digests, xstate);
+            }
+            while (halves.size() >= lanes);
+        }
+    }
+}
+
+TEMPLATE
+INLINE size_t CLASS::
+hash_vector(digests_t& digests, const halves_t& halves) NOEXCEPT
+{
+    BC_ASSERT(digests.size() == halves.size());
+
+    if (halves.size() < min_lanes)
+        return zero;
+
+    const auto size = halves.size();
+    auto ihalves = ihalves_t{ size * array_count<half_t>, halves.front().data() };
+    auto idigests = idigests_t{ size * array_count<digest_t>, digests.front().data() };
+
+    if constexpr (use_512)
+        hash_vector<xint512_t>(idigests, ihalves);
+
+    if constexpr (use_256)
+        hash_vector<xint256_t>(idigests, ihalves);
+
+    if constexpr (use_128)
+        hash_vector<xint128_t>(idigests, ihalves);
+
+    // ihalves.size() is reduced by vectorization.
+    return size - ihalves.size();
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hash(const halves_t& halves) NOEXCEPT
+{
+    digests_t digests(halves.size());
+    auto next = zero;
+
+    // Half block vectorization is applied at 16/8/4 lanes (as available) and
+    // falls back to normal form for any remaining (less than 4) halves.
+    if constexpr (vector)
+        next = hash_vector(digests, halves);
+
+    for (; next < halves.size(); ++next)
+        digests[next] = hash(halves[next]);
+
+    return digests;
+}
+
 // Streaming hash functions and finalizers.
 // ---------------------------------------------------------------------------
 
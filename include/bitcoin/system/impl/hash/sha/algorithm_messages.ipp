@@ -0,0 +1,353 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_MESSAGES_IPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_MESSAGES_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+// Multiple message hashing.
+// ============================================================================
+// Independent messages of varying length are padded per lane and compressed
+// concurrently, one block of each message per vectorized compression. Lanes
+// are grouped by descending block count, so that a group's lanes complete at
+// similar times. The state of a completed lane is retained by masking until
+// the longest message of its group completes.
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+// padding
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+constexpr size_t CLASS::
+message_blocks(size_t size) NOEXCEPT
+{
+    // Message, one pad byte, and count, rounded up to whole blocks.
+    constexpr auto block_bytes = array_count<block_t>;
+    return ceilinged_divide(size + add1(count_bytes), block_bytes);
+}
+
+TEMPLATE
+void CLASS::
+message_block(block_t& block, const message_t& message, size_t size,
+    size_t index) NOEXCEPT
+{
+    constexpr auto block_bytes = array_count<block_t>;
+    const auto start = index * block_bytes;
+    const auto end = std::min(start + block_bytes, size);
+    auto to = block.begin();
+
+    // Copy message bytes of this block (if any) from each slice.
+    auto position = zero;
+    for (const auto& slice: message)
+    {
+        const auto first = std::max(start, position);
+        const auto last = std::min(end, position + slice.size());
+        if (first < last)
+            to = std::copy_n(std::next(slice.begin(), first - position),
+                last - first, to);
+
+        position += slice.size();
+    }
+
+    // The remainder of the block is padding.
+    std::fill(to, block.end(), byte_t{});
+
+    // The pad byte immediately follows the message (may be in this block).
+    if (size >= start && size < start + block_bytes)
+        block[size - start] = bit_hi<byte_t>;
+
+    // The count (bits) is big-endian in the last count_bytes of the message.
+    if (index == sub1(message_blocks(size)))
+    {
+        const auto bits = to_big_endian(possible_narrow_cast<uint64_t>(
+            to_bits(size)));
+        std::copy(bits.begin(), bits.end(),
+            std::prev(block.end(), array_count<decltype(bits)>));
+    }
+}
+
+// expanded lanes
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <typename xWord>
+INLINE auto CLASS::
+xmask(const size_t* group, const sizes_t& blocks, size_t block) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    // All bits set for a lane that has completed its message.
+    const auto done = [&](size_t lane) NOEXCEPT
+    {
+        return block >= blocks[group[lane]] ? bit_all<word_t> : word_t{};
+    };
+
+    if constexpr (lanes == 2)
+    {
+        return f::set<xWord>(
+            done(0), done(1));
+    }
+    else if constexpr (lanes == 4)
+    {
+        return f::set<xWord>(
+            done(0), done(1), done(2), done(3));
+    }
+    else if constexpr (lanes == 8)
+    {
+        return f::set<xWord>(
+            done(0), done(1), done(2), done(3),
+            done(4), done(5), done(6), done(7));
+    }
+    else if constexpr (lanes == 16)
+    {
+        return f::set<xWord>(
+            done( 0), done( 1), done( 2), done( 3),
+            done( 4), done( 5), done( 6), done( 7),
+            done( 8), done( 9), done(10), done(11),
+            done(12), done(13), done(14), done(15));
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xscatter(digests_t& digests, const size_t* group,
+    const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    digests[group[0]] = unpack<0>(xstate);
+    digests[group[1]] = unpack<1>(xstate);
+
+    if constexpr (lanes >= 4)
+    {
+        digests[group[2]] = unpack<2>(xstate);
+        digests[group[3]] = unpack<3>(xstate);
+    }
+
+    if constexpr (lanes >= 8)
+    {
+        digests[group[4]] = unpack<4>(xstate);
+        digests[group[5]] = unpack<5>(xstate);
+        digests[group[6]] = unpack<6>(xstate);
+        digests[group[7]] = unpack<7>(xstate);
+    }
+
+    if constexpr (lanes >= 16)
+    {
+        digests[group[8]] = unpack<8>(xstate);
+        digests[group[9]] = unpack<9>(xstate);
+        digests[group[10]] = unpack<10>(xstate);
+        digests[group[11]] = unpack<11>(xstate);
+        digests[group[12]] = unpack<12>(xstate);
+        digests[group[13]] = unpack<13>(xstate);
+        digests[group[14]] = unpack<14>(xstate);
+        digests[group[15]] = unpack<15>(xstate);
+    }
+}
+
+// vectorizable messages hashing
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <bool Double, typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+messages_vector(digests_t& digests, const messages_t& messages,
+    const sizes_t& sizes, const sizes_t& blocks, const sizes_t& order,
+    size_t& next) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>)
+    {
+        if (order.size() - next >= lanes)
+        {
+            // TODO: expose const structs to avoid local static.
+            static const auto initial = pack<xWord>(H::get);
+
+            ablocks_t<lanes> xblock{};
+            xbuffer_t<xWord> xbuffer{};
+
+            do
+            {
+                // Descending order, the first lane has the most blocks.
+                const auto group = std::next(order.data(), next);
+                const auto fewest = blocks[group[sub1(lanes)]];
+                const auto most = blocks[group[0]];
+                auto xstate = initial;
+
+                for (size_t block{}; block < most; ++block)
+                {
+                    // Completed lanes retain their last block (masked).
+                    for (size_t lane{}; lane < lanes; ++lane)
+                    {
+                        const auto index = group[lane];
+                        if (block < blocks[index])
+                            message_block(xblock[lane], messages[index],
+                                sizes[index], block);
+                    }
+
+                    // xinput() advances block iterator by lanes.
+                    iblocks_t iblocks{ array_cast<byte_t>(xblock) };
+                    xinput(xbuffer, iblocks);
+                    schedule_(xbuffer);
+
+                    if (block < fewest)
+                    {
+                        compress_(xstate, xbuffer);
+                    }
+                    else
+                    {
+                        // Restore the state of completed lanes.
+                        const auto mask = xmask<xWord>(group, blocks, block);
+                        const auto prior = xstate;
+                        compress_(xstate, xbuffer);
+
+                        for (size_t word{}; word < xstate.size(); ++word)
+                            xstate[word] = f::xor_(xstate[word],
+                                f::and_(mask, f::xor_(xstate[word],
+                                    prior[word])));
+                    }
+                }
+
+                if constexpr (Double)
+                {
+                    // Second hash
+                    inject_left_half(xbuffer, xstate);
+                    pad_half(xbuffer);
+                    schedule_(xbuffer);
+                    xstate = initial;
+                    compress_(xstate, xbuffer);
+                }
+
+                xscatter(digests, group, xstate);
+                next += lanes;
+            }
+            while (order.size() - next >= lanes);
+        }
+    }
+}
+
+TEMPLATE
+template <bool Double>
+typename CLASS::digests_t CLASS::
+messages_hash(const messages_t& messages) NOEXCEPT
+{
+    const auto count = messages.size();
+    digests_t digests(count);
+    sizes_t sizes(count);
+    sizes_t blocks(count);
+    sizes_t order(count);
+
+    for (size_t index{}; index < count; ++index)
+    {
+        const auto& message = messages[index];
+        sizes[index] = std::accumulate(message.begin(), message.end(), zero,
+            [](size_t total, const data_slice& slice) NOEXCEPT
+            {
+                return total + slice.size();
+            });
+
+        blocks[index] = message_blocks(sizes[index]);
+    }
+
+    // Group messages of similar block count into lanes (longest first).
+    std::iota(order.begin(), order.end(), zero);
+    std::stable_sort(order.begin(), order.end(),
+        [&](size_t left, size_t right) NOEXCEPT
+        {
+            return blocks[left] > blocks[right];
+        });
+
+    auto next = zero;
+    if constexpr (vector)
+    {
+        if (count >= min_lanes)
+        {
+            // Always use if available.
+            if constexpr (use_512)
+                messages_vector<Double, xint512_t>(digests, messages, sizes,
+                    blocks, order, next);
+
+            // Only use if shani is not available.
+            if constexpr (use_256 && !native)
+                messages_vector<Double, xint256_t>(digests, messages, sizes,
+                    blocks, order, next);
+
+            // Only use if shani is not available.
+            if constexpr (use_128 && !native)
+                messages_vector<Double, xint128_t>(digests, messages, sizes,
+                    blocks, order, next);
+        }
+    }
+
+    // Complete the (shortest) remaining messages using normal form.
+    block_t block{};
+    for (; next < count; ++next)
+    {
+        const auto index = order[next];
+        auto state = H::get;
+        for (size_t at{}; at < blocks[index]; ++at)
+        {
+            message_block(block, messages[index], sizes[index], at);
+            accumulate(state, block);
+        }
+
+        if constexpr (Double)
+            digests[index] = finalize_second(state);
+        else
+            digests[index] = normalize(state);
+    }
+
+    return digests;
+}
+
+// interface
+// ----------------------------------------------------------------------------
+// public
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hash(const messages_t& messages) NOEXCEPT
+{
+    return messages_hash<false>(messages);
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+double_hash(const messages_t& messages) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+    return messages_hash<true>(messages);
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -928,7 +928,11 @@ op_ripemd160() NOEXCEPT
     if (this->is_stack_empty())
         return error::op_ripemd160;
 
-    this->push_chunk(rmd160_chunk(*this->pop_chunk_()));
+    stack_chunk buffer{};
+    const auto data = this->peek_slice_(buffer);
+    const auto hash = rmd160_hash(data.size(), data.data());
+    this->drop_();
+    this->push_inline(hash);
     return error::op_success;
 }
 
@@ -939,7 +943,11 @@ op_sha1() NOEXCEPT
     if (this->is_stack_empty())
         return error::op_sha1;
 
-    this->push_chunk(sha1_chunk(*this->pop_chunk_()));
+    stack_chunk buffer{};
+    const auto data = this->peek_slice_(buffer);
+    const auto hash = sha1_hash(data.size(), data.data());
+    this->drop_();
+    this->push_inline(hash);
     return error::op_success;
 }
 
@@ -950,7 +958,11 @@ op_sha256() NOEXCEPT
     if (this->is_stack_empty())
         return error::op_sha256;
 
-    this->push_chunk(sha256_chunk(*this->pop_chunk_()));
+    stack_chunk buffer{};
+    const auto data = this->peek_slice_(buffer);
+    const auto hash = sha256_hash(data.size(), data.data());
+    this->drop_();
+    this->push_inline(hash);
     return error::op_success;
 }
 
@@ -961,7 +973,11 @@ op_hash160() NOEXCEPT
     if (this->is_stack_empty())
         return error::op_hash160;
 
-    this->push_chunk(bitcoin_short_chunk(*this->pop_chunk_()));
+    stack_chunk buffer{};
+    const auto data = this->peek_slice_(buffer);
+    const auto hash = bitcoin_short_hash(data.size(), data.data());
+    this->drop_();
+    this->push_inline(hash);
     return error::op_success;
 }
 
@@ -972,7 +988,11 @@ op_hash256() NOEXCEPT
     if (this->is_stack_empty())
         return error::op_hash256;
 
-    this->push_chunk(bitcoin_chunk(*this->pop_chunk_()));
+    stack_chunk buffer{};
+    const auto data = this->peek_slice_(buffer);
+    const auto hash = bitcoin_hash(data.size(), data.data());
+    this->drop_();
+    this->push_inline(hash);
     return error::op_success;
 }
 
@@ -44,16 +44,66 @@ connect(const chain::context& state, const chain::transaction& tx,
     return connect(state, tx, std::next(tx.inputs_ptr()->begin(), index), {});
 }
 
+// Inputs validated under the same flags (e.g. at pool acceptance) are not
+// reevaluated. Captured signatures are deferred (not yet validated), so
+// results under capture are not cached.
 TEMPLATE
 code CLASS::
 connect(const chain::context& state, const chain::transaction& tx,
     const input_iterator& it, const chain::signatures& capture) NOEXCEPT
+{
+    if (!(*it)->prevout)
+        return error::missing_previous_output;
+
+    if (!script_cache::enabled())
+        return connect_input(state, tx, it, capture);
+
+    // Witness hash is set in advance of concurrent input connects.
+    const auto& wtxid = tx.get_hash(true);
+    const auto index = possible_narrow_sign_cast<uint32_t>(
+        std::distance(tx.inputs_ptr()->begin(), it));
+
+    if (script_cache::has(wtxid, index, state.flags))
+        return error::script_success;
+
+    const auto ec = connect_input(state, tx, it, capture);
+    if (!ec && !capture.enabled)
+        script_cache::put(wtxid, index, state.flags);
+
+    return ec;
+}
+
+// Standard (p2pkh, p2wpkh, p2tr key path) spends are verified without a
+// program. These are not captured, and any failure is reevaluated by program
+// in order to obtain its precise error code.
+// static/protected
+TEMPLATE
+code CLASS::connect_input(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it,
+    const chain::signatures& capture) NOEXCEPT
+{
+    if (!capture.enabled && standard::verify(state, tx, it))
+        return error::script_success;
+
+    return connect_program(state, tx, it, capture);
+}
+
+// static/protected
+TEMPLATE
+code CLASS::connect_program(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it,
+    const chain::signatures& capture) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
     if (!input.prevout)
         return error::missing_previous_output;
 
+    // Stacks of any prior input on this thread are out of scope, so the thread
+    // stack arena is reclaimed in constant time (all programs are local).
+    if constexpr (is_same_type<Stack, arena_stack>)
+        stack_arena::get()->start(zero);
+
     // Evaluate input script.
     interpreter in_program(tx, it, state.flags, capture);
     if (const auto ec = in_program.run())
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_MACHINE_INTERPRETER_RUN_IPP
 #define LIBBITCOIN_SYSTEM_MACHINE_INTERPRETER_RUN_IPP
 
+#include <array>
 #include <iterator>
 #include <utility>
 #include <bitcoin/system/chain/chain.hpp>
@@ -37,6 +38,17 @@ namespace machine {
 TEMPLATE
 code CLASS::
 run() NOEXCEPT
+{
+    if constexpr (Threaded)
+        return run_threaded();
+    else
+        return run_switch();
+}
+
+// protected
+TEMPLATE
+code CLASS::
+run_switch() NOEXCEPT
 {
     if (const auto ec = state::initialize())
         return ec;
@@ -67,6 +79,128 @@ run() NOEXCEPT
     return error::script_success;
 }
 
+// Equivalent to run_switch, with the per-operation tests hoisted into decode.
+// Within an unexecuted branch only conditionals execute, so the intervening
+// operations are skipped as a block, accumulating their count. Nested
+// conditionals are jump targets, as they must stack their (false) condition.
+// protected
+TEMPLATE
+code CLASS::
+run_threaded() NOEXCEPT
+{
+    if (const auto ec = state::initialize())
+        return ec;
+
+    // Runs do not nest on a thread, so the program buffer is reused by each,
+    // and allocates only when a script exceeds all preceding on the thread.
+    static thread_local instructions program{};
+    decode(program, state::begin(), state::end());
+    const auto first = program.data();
+
+    for (auto ip = first; !is_null(ip->execute);)
+    {
+        if (ip->oversized)
+            return error::invalid_push_data_size;
+
+        if (!ip->conditional && !state::is_success())
+        {
+            const auto next = std::next(first, ip->skip);
+            if (!state::ops_increment(next->counted - ip->counted))
+                return error::invalid_operation_count;
+
+            ip = next;
+            continue;
+        }
+
+        if (!state::ops_increment(*ip->op))
+            return error::invalid_operation_count;
+
+        if (const auto ec = ip->execute(*this, ip->op))
+            return ec;
+
+        if (state::is_stack_overflow())
+            return error::invalid_stack_size;
+
+        ++ip;
+    }
+
+    if (!state::is_balanced())
+        return error::invalid_stack_scope;
+
+    return error::script_success;
+}
+
+// Pre-decode.
+// ----------------------------------------------------------------------------
+
+// protected
+TEMPLATE
+void CLASS::
+decode(instructions& program, const op_iterator& begin,
+    const op_iterator& end) NOEXCEPT
+{
+    static constexpr auto handlers = to_handlers(
+        std::make_index_sequence<add1<size_t>(max_uint8)>{});
+
+    // Operation count is limited by script size, which is limited by block.
+    const auto size = possible_narrow_sign_cast<uint32_t>(std::distance(begin, end));
+
+    program.clear();
+    program.reserve(add1(size));
+
+    uint32_t counted{};
+    for (auto it = begin; it != end; ++it)
+    {
+        const auto code = it->code();
+        program.push_back(
+        {
+            handlers[static_cast<uint8_t>(code)],
+            it,
+            size,
+            counted,
+            operation::is_conditional(code),
+            it->is_oversized()
+        });
+
+        if (operation::is_counted(code))
+            ++counted;
+    }
+
+    // Terminator (execute is nullptr), carries total count for the last skip.
+    program.push_back({ nullptr, end, size, counted, false, false });
+
+    // Each skip targets the next operation that must be visited.
+    auto skip = size;
+    for (auto index = size; !is_zero(index); --index)
+    {
+        auto& instruction = program.at(sub1(index));
+        instruction.skip = skip;
+        if (instruction.conditional || instruction.oversized)
+            skip = sub1(index);
+    }
+}
+
+// protected
+TEMPLATE
+template <size_t... Code>
+consteval auto CLASS::
+to_handlers(std::index_sequence<Code...>) NOEXCEPT
+{
+    return std::array<handler, sizeof...(Code)>
+    {
+        &dispatch<static_cast<opcode>(Code)>...
+    };
+}
+
+// protected
+TEMPLATE
+template <chain::opcode Code>
+error::op_error_t CLASS::
+dispatch(interpreter& self, const op_iterator& op) NOEXCEPT
+{
+    return self.execute(Code, op);
+}
+
 // Operation disatch.
 // ----------------------------------------------------------------------------
 // It is expected that the compiler will produce a very efficient jump table.
@@ -76,8 +210,14 @@ TEMPLATE
 error::op_error_t CLASS::
 run_op(const op_iterator& op) NOEXCEPT
 {
-    const auto code = op->code();
+    return execute(op->code(), op);
+}
 
+// protected
+TEMPLATE
+INLINE error::op_error_t CLASS::
+execute(opcode code, const op_iterator& op) NOEXCEPT
+{
     switch (code)
     {
         case opcode::push_size_0:
@@ -159,10 +159,18 @@ peek_size() const NOEXCEPT
     return primary_.peek_size();
 }
 
+// Slice is invalidated by drop_ unless top is a pointer chunk.
+TEMPLATE
+INLINE data_slice CLASS::
+peek_slice_(stack_chunk& buffer) const NOEXCEPT
+{
+    return primary_.peek_slice(buffer);
+}
+
 // Primary stack (push).
 // ----------------------------------------------------------------------------
 
-// This is the only source of push (write) tethering.
+// This is the only source of push (write) tethering (unused by script ops).
 TEMPLATE
 INLINE void CLASS::
 push_chunk(data_chunk&& datum) NOEXCEPT
@@ -191,6 +199,14 @@ push_chunk(const chunk_xptr& datum) NOEXCEPT
     primary_.emplace_chunk(datum);
 }
 
+// Computed chunks (hashes) are held inline, avoiding allocation/tethering.
+TEMPLATE
+INLINE void CLASS::
+push_inline(const stack_chunk& datum) NOEXCEPT
+{
+    primary_.emplace_inline(datum);
+}
+
 TEMPLATE
 INLINE void CLASS::
 push_bool(bool value) NOEXCEPT
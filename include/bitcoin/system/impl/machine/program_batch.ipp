@@ -41,6 +41,10 @@ inline bool CLASS::
 verify_ecdsa_signature(const data_chunk& point, const hash_digest& hash,
     const ec_signature& signature, bool capture) const NOEXCEPT
 {
+    // Previously verified (e.g. at pool acceptance), bypass capture.
+    if (signature_cache::has_ecdsa(point, hash, signature))
+        return true;
+
     if (capture_.enabled && capture)
     {
         if (is_ecdsa_batchable())
@@ -51,7 +55,7 @@ verify_ecdsa_signature(const data_chunk& point, const hash_digest& hash,
                 // Count as missed, consistent with not batchable telemetry.
                 capture_.fire(chain::signatures::miss::ecdsa, one);
                 capture_.log(*script_);
-                return ecdsa::verify_signature(point, hash, signature);
+                return verify_ecdsa_inline(point, hash, signature);
             }
 
             // Capture is bypass (single sigop).
@@ -72,7 +76,7 @@ verify_ecdsa_signature(const data_chunk& point, const hash_digest& hash,
         }
     }
 
-    return ecdsa::verify_signature(point, hash, signature);
+    return verify_ecdsa_inline(point, hash, signature);
 }
 
 TEMPLATE
@@ -123,15 +127,20 @@ inline bool CLASS::
 verify_schnorr_signature(const data_chunk& point, const hash_digest& hash,
     const ec_signature& signature) const NOEXCEPT
 {
+    if (capture_.enabled && is_threshold_batchable())
+    {
+        // Capture is bypass (rows preallocated at gate).
+        threshold_.sink.write(hash, as_xonly(point), signature);
+        return true;
+    }
+
+    // Previously verified (e.g. at pool acceptance), bypass capture.
+    if (signature_cache::has_schnorr(as_xonly(point), hash, signature))
+        return true;
+
     if (capture_.enabled)
     {
-        if (is_threshold_batchable())
-        {
-            // Capture is bypass (rows preallocated at gate).
-            threshold_.sink.write(hash, as_xonly(point), signature);
-            return true;
-        }
-        else if (is_schnorr_batchable())
+        if (is_schnorr_batchable())
         {
             // Capture is bypass (single sigop).
             if (capture_.schnorr(hash, as_xonly(point), signature))
@@ -151,7 +160,7 @@ verify_schnorr_signature(const data_chunk& point, const hash_digest& hash,
         }
     }
 
-    return schnorr::verify_signature(point, hash, signature);
+    return verify_schnorr_inline(as_xonly(point), hash, signature);
 }
 
 TEMPLATE
@@ -184,6 +193,31 @@ is_threshold_batchable() const NOEXCEPT
 // ----------------------------------------------------------------------------
 // private
 
+// Successful inline verifications are cached for subsequent (block) use.
+TEMPLATE
+inline bool CLASS::
+verify_ecdsa_inline(const data_chunk& point, const hash_digest& hash,
+    const ec_signature& signature) const NOEXCEPT
+{
+    if (!ecdsa::verify_signature(point, hash, signature))
+        return false;
+
+    signature_cache::put_ecdsa(point, hash, signature);
+    return true;
+}
+
+TEMPLATE
+inline bool CLASS::
+verify_schnorr_inline(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature) const NOEXCEPT
+{
+    if (!schnorr::verify_signature(point, hash, signature))
+        return false;
+
+    signature_cache::put_schnorr(point, hash, signature);
+    return true;
+}
+
 TEMPLATE
 inline bool CLASS::
 parse_ecdsa_multisig(hash_digest& hash, keys_array& keys,
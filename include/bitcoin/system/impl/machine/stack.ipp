@@ -90,16 +90,9 @@ TEMPLATE
 INLINE void CLASS::
 push(data_chunk&& value) NOEXCEPT
 {
-    // The following script operations will ALWAYS tether chunks, as the result
-    // of a computed hash is *pushed* to the weak pointer (xptr) variant stack.
-    // make_external attaches value to tether returns weak pointer (chunk_xptr).
-    //
-    // op_ripemd160         (1)
-    // op_sha1              (1)
-    // op_sha256            (1)
-    // op_hash160           (1)
-    // op_hash256           (1)
-
+    // Script operations do not push chunks by value, as computed hashes are
+    // emplaced inline. make_external attaches value to tether returns weak
+    // pointer (chunk_xptr).
     container_.push_back(make_external(std::move(value), tether_));
 }
 
@@ -138,6 +131,21 @@ emplace_chunk(const chunk_xptr& value) NOEXCEPT
     container_.emplace_back(value.get());
 }
 
+TEMPLATE
+INLINE void CLASS::
+emplace_inline(const stack_chunk& value) NOEXCEPT
+{
+    // The following script operations emplace (and do not tether) chunks.
+    //
+    // op_ripemd160         (1)
+    // op_sha1              (1)
+    // op_sha256            (1)
+    // op_hash160           (1)
+    // op_hash256           (1)
+
+    container_.emplace_back(value);
+}
+
 // Positional (stack cheats).
 // ----------------------------------------------------------------------------
 // These optimizations prevent used of std::stack.
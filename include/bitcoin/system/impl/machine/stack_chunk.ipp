@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_CHUNK_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_STACK_CHUNK_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/machine/number.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// Conversions.
+// ----------------------------------------------------------------------------
+
+inline stack_chunk stack_chunk::
+from_bool(bool vary) NOEXCEPT
+{
+    stack_chunk out{};
+    if (vary)
+        out.bytes_[out.size_++] = 1;
+
+    return out;
+}
+
+// Minimally-sized byte encoding, with extra byte if negated.
+inline stack_chunk stack_chunk::
+from_integer(int64_t vary) NOEXCEPT
+{
+    using namespace number;
+    stack_chunk out{};
+
+    // absolute(minimum<int64_t>) guarded by the presumption of int32 ops.
+    BC_ASSERT(!is_negate_overflow(vary));
+
+    if (is_zero(vary))
+        return out;
+
+    auto value = absolute(vary);
+    while (!is_zero(value))
+    {
+        out.bytes_[out.size_++] = narrow_cast<uint8_t>(value);
+        value >>= byte_bits;
+    }
+
+    const auto back = sub1(out.size_);
+    const auto negated = is_negated(out.bytes_[back]);
+    const auto negative = is_negative(vary);
+
+    // Indicate the sign.
+    if (negated && negative)
+        out.bytes_[out.size_++] = negative_sign_byte;
+    else if (negated)
+        out.bytes_[out.size_++] = positive_sign_byte;
+    else if (negative)
+        out.bytes_[back] = to_negated(out.bytes_[back]);
+
+    return out;
+}
+
+// Construct.
+// ----------------------------------------------------------------------------
+
+constexpr stack_chunk::
+stack_chunk() NOEXCEPT
+  : bytes_{}, size_{}
+{
+}
+
+template <size_t Size, if_not_greater<Size, stack_chunk::capacity>>
+constexpr stack_chunk::
+stack_chunk(const data_array<Size>& data) NOEXCEPT
+  : bytes_{}, size_{ narrow_cast<uint8_t>(Size) }
+{
+    std::copy(data.begin(), data.end(), bytes_.begin());
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+constexpr size_t stack_chunk::
+size() const NOEXCEPT
+{
+    return size_;
+}
+
+constexpr bool stack_chunk::
+empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+constexpr data_slice stack_chunk::
+slice() const NOEXCEPT
+{
+    const auto begin = bytes_.data();
+    return { begin, std::next(begin, size_) };
+}
+
+inline data_chunk stack_chunk::
+to_chunk() const NOEXCEPT
+{
+    return slice().to_chunk();
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+constexpr bool stack_chunk::
+operator==(const stack_chunk& other) const NOEXCEPT
+{
+    return slice() == other.slice();
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -59,6 +59,11 @@ peek_signed(Integer& value) const NOEXCEPT
         {
             // This is never executed in standard scripts.
             result = integer<Bytes>::from_chunk(value, *vary);
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            result = integer<Bytes>::from_chunk(value, vary.to_chunk());
         }
     }, top());
 
@@ -93,6 +98,11 @@ peek_bool() const NOEXCEPT
         {
             // This is never executed in standard scripts.
             value = boolean::from_chunk(*vary);
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            value = boolean::from_chunk(vary.to_chunk());
         }
     }, top());
 
@@ -123,6 +133,11 @@ peek_strict_bool() const NOEXCEPT
         {
             // This may be executed in standard scripts (without bip147).
             value = boolean::from_chunk_strict(*vary);
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            value = boolean::from_chunk_strict(vary.to_chunk());
         }
     }, top());
 
@@ -154,6 +169,11 @@ peek_minimal_bool(bool& value) const NOEXCEPT
         {
             // This may be executed in tapscripts.
             result = boolean::from_chunk(value, *vary);
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is never executed in standard tapscripts.
+            result = boolean::from_chunk(value, vary.to_chunk());
         }
     }, top());
 
@@ -173,17 +193,22 @@ peek_size() const NOEXCEPT
         [&](bool vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = chunk::from_bool(vary).size();
+            value = stack_chunk::from_bool(vary).size();
         },
         [&](int64_t vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = chunk::from_integer(vary).size();
+            value = stack_chunk::from_integer(vary).size();
         },
         [&](const chunk_xptr& vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
             value = vary->size();
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            value = vary.size();
         }
     }, top());
 
@@ -199,16 +224,10 @@ peek_chunk() const NOEXCEPT
     chunk_xptr value{};
 
     // The following script operations will ONLY tether chunks in case where
-    // the *popped* element was originally bool/int64_t but required as chunk.
-    // This is never the case in standard scripts. make_external attaches moved
-    // chunk to tether and returns weak pointer (chunk_xptr).
+    // the *popped* element was originally bool/int64_t/inline but required as
+    // chunk pointer. This is never the case in standard scripts. make_external
+    // attaches moved chunk to tether and returns weak pointer (chunk_xptr).
     //
-    // op_ripemd160         (0..1)
-    // op_sha1              (0..1)
-    // op_sha256            (0..1)
-    // op_hash160           (0..1)
-    // op_hash256           (0..1)
-    // op_size              (0..1)
     // op_check_sig_add     (0..2)
     // op_check_sig         (0..2, and m (endorsements) + n (keys))
     // op_check_sig_verify  (0..2, and m (endorsements) + n (keys))
@@ -229,12 +248,71 @@ peek_chunk() const NOEXCEPT
         {
             // This is the canonical use case.
             value = vary;
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            value = make_external(vary.to_chunk(), tether_);
         }
     }, top());
 
     return value;
 }
 
+// Could use peek_chunk but this overload skips allocation and tethering.
+// The returned slice is invalidated by drop unless top is a chunk pointer.
+TEMPLATE
+data_slice CLASS::
+peek_slice(stack_chunk& buffer) const NOEXCEPT
+{
+    // The following script operations read the top element as a slice.
+    //
+    // op_ripemd160         (1)
+    // op_sha1              (1)
+    // op_sha256            (1)
+    // op_hash160           (1)
+    // op_hash256           (1)
+
+    return to_slice(top(), buffer);
+}
+
+// private
+// Non-chunk values are encoded into the buffer, referenced by the slice.
+TEMPLATE
+data_slice CLASS::
+to_slice(const stack_variant& element, stack_chunk& buffer) NOEXCEPT
+{
+    data_slice value{};
+
+    std::visit(overload
+    {
+        [&](bool vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            buffer = stack_chunk::from_bool(vary);
+            value = buffer.slice();
+        },
+        [&](int64_t vary) NOEXCEPT
+        {
+            // This is never executed in standard scripts.
+            buffer = stack_chunk::from_integer(vary);
+            value = buffer.slice();
+        },
+        [&](const chunk_xptr& vary) NOEXCEPT
+        {
+            // This is the canonical use case.
+            value = *vary;
+        },
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            // This is the canonical use case (hash of hash).
+            value = vary.slice();
+        }
+    }, element);
+
+    return value;
+}
+
 TEMPLATE
 INLINE size_t CLASS::
 peek_nonempty() const NOEXCEPT
@@ -259,6 +337,11 @@ peek_nonempty() const NOEXCEPT
             {
                 if (vary && !vary->empty())
                     ++count;
+            },
+            [&](const stack_chunk& vary) NOEXCEPT
+            {
+                if (!vary.empty())
+                    ++count;
             }
         }, element);
     }
@@ -292,8 +375,10 @@ equal_chunks(const stack_variant& left, const stack_variant& right) NOEXCEPT
                 case stack_type::int64_:
                     same = std::get<int64_t>(right) == to_int(vary);
                     break;
-                case stack_type::pchunk_:
-                    same = *std::get<chunk_xptr>(right) == chunk::from_bool(vary);
+                default:
+                    stack_chunk buffer{};
+                    same = to_slice(right, buffer) ==
+                        stack_chunk::from_bool(vary).slice();
             }
         },
 
@@ -308,28 +393,25 @@ equal_chunks(const stack_variant& left, const stack_variant& right) NOEXCEPT
                 case stack_type::int64_:
                     same = std::get<int64_t>(right) == vary;
                     break;
-                case stack_type::pchunk_:
-                    same = *std::get<chunk_xptr>(right) == chunk::from_integer(vary);
+                default:
+                    stack_chunk buffer{};
+                    same = to_slice(right, buffer) ==
+                        stack_chunk::from_integer(vary).slice();
             }
         },
 
-        // This is the canonical use case.
-        [&](chunk_xptr vary) NOEXCEPT
+        // This is the canonical use case (pushed chunk).
+        [&](const chunk_xptr& vary) NOEXCEPT
         {
-            switch (right.index())
-            {
-                case stack_type::bool_:
-                    // This is never executed in standard scripts.
-                    same = chunk::from_bool(std::get<bool>(right)) == *vary;
-                    break;
-                case stack_type::int64_:
-                    // This is never executed in standard scripts.
-                    same = chunk::from_integer(std::get<int64_t>(right)) == *vary;
-                    break;
-                case stack_type::pchunk_:
-                    // This is the canonical use case.
-                    same = *std::get<chunk_xptr>(right) == *vary;
-            }
+            stack_chunk buffer{};
+            same = to_slice(right, buffer) == *vary;
+        },
+
+        // This is the canonical use case (computed hash).
+        [&](const stack_chunk& vary) NOEXCEPT
+        {
+            stack_chunk buffer{};
+            same = to_slice(right, buffer) == vary.slice();
         }
     }, left);
 
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <ranges>
 #include <string_view>
+#include <type_traits>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
@@ -107,8 +108,14 @@ constexpr std::string encode_base16(const data_slice& data) NOEXCEPT
 {
     std::string out{};
     out.resize(data.size() * octet_width);
-    auto digit = out.begin();
 
+    if (!std::is_constant_evaluated())
+    {
+        encode_base16(out.data(), data.data(), data.size());
+        return out;
+    }
+
+    auto digit = out.begin();
     for (const auto octet: data)
     {
         *digit++ = to_base16_hi_character(octet);
@@ -123,8 +130,14 @@ constexpr std::string encode_hash(const data_slice& hash) NOEXCEPT
 {
     std::string out{};
     out.resize(hash.size() * octet_width);
-    auto digit = out.begin();
 
+    if (!std::is_constant_evaluated())
+    {
+        encode_hash(out.data(), hash.data(), hash.size());
+        return out;
+    }
+
+    auto digit = out.begin();
     for (const auto octet: std::views::reverse(hash))
     {
         *digit++ = to_base16_hi_character(octet);
@@ -143,6 +156,16 @@ constexpr bool decode_base16(data_chunk& out,
     if (!is_multiple(in.size(), octet_width))
         return false;
 
+    if (!std::is_constant_evaluated())
+    {
+        out.resize(in.size() / octet_width);
+        if (decode_base16(out.data(), in.data(), out.size()))
+            return true;
+
+        out.clear();
+        return false;
+    }
+
     if (!std::all_of(in.begin(), in.end(), is_base16<char>))
         return false;
 
@@ -166,6 +189,9 @@ constexpr bool decode_base16(data_array<Size>& out,
     if (!is_product(in.size(), octet_width, Size))
         return false;
 
+    if (!std::is_constant_evaluated())
+        return decode_base16(out.data(), in.data(), Size);
+
     if (!std::all_of(in.begin(), in.end(), is_base16<char>))
         return false;
 
@@ -188,6 +214,9 @@ constexpr bool decode_hash(data_array<Size>& out,
     if (in.size() != Size * octet_width)
         return false;
 
+    if (!std::is_constant_evaluated())
+        return decode_hash(out.data(), in.data(), Size);
+
     if (!std::all_of(in.begin(), in.end(), is_base16<char>))
         return false;
 
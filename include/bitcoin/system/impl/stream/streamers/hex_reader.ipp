@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_BASE16_READER_IPP
 #define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_BASE16_READER_IPP
 
+#include <algorithm>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/radix/radix.hpp>
@@ -68,20 +69,23 @@ void hex_reader<IStream>::do_read_bytes(uint8_t* buffer,
         return;
     }
 
-    char chars[octet_width]{};
+    // Fixed buffer avoids reading to dynamically-allocated buffer of size.
+    constexpr size_t block = 256;
+    char chars[block * octet_width]{};
     const auto bytes = pointer_cast<uint8_t>(&chars[zero]);
 
-    // Iteration avoids writing to dynamically-allocated buffer of size.
-    for (auto octet = buffer; octet < std::next(buffer, size); ++octet)
+    while (!is_zero(size))
     {
-        base::do_read_bytes(bytes, octet_width);
-        if (!is_base16(chars[0]) || !is_base16(chars[1]))
+        const auto count = std::min(size, block);
+        base::do_read_bytes(bytes, count * octet_width);
+        if (!decode_base16(buffer, &chars[zero], count))
         {
             this->invalidate();
             return;
         }
 
-        *octet = from_base16_characters(chars[0], chars[1]);
+        buffer = std::next(buffer, count);
+        size -= count;
     }
 }
 
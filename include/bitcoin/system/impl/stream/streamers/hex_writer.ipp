@@ -54,16 +54,19 @@ void hex_writer<OStream>::do_write_bytes(const uint8_t* data,
 {
     BC_ASSERT(!is_multiply_overflow(size, octet_width));
 
-    char chars[octet_width]{};
+    // Fixed buffer avoids writing to dynamically-allocated buffer of size.
+    constexpr size_t block = 256;
+    char chars[block * octet_width]{};
     const auto bytes = pointer_cast<uint8_t>(&chars[zero]);
 
-    // Iteration avoids writing to dynamically-allocated buffer of size.
-    std::for_each_n(data, size, [&](uint8_t octet) NOEXCEPT
+    while (!is_zero(size))
     {
-        chars[0] = to_base16_hi_character(octet);
-        chars[1] = to_base16_lo_character(octet);
-        base::do_write_bytes(bytes, octet_width);
-    });
+        const auto count = std::min(size, block);
+        encode_base16(&chars[zero], data, count);
+        base::do_write_bytes(bytes, count * octet_width);
+        data = std::next(data, count);
+        size -= count;
+    }
 }
 
 } // namespace system
@@ -43,6 +43,13 @@ sha256t_writer<Tag, OStream>::sha256t_writer(OStream& sink) NOEXCEPT
 {
 }
 
+template <data_t Tag, typename OStream>
+sha256t_writer<Tag, OStream>::sha256t_writer(OStream& sink,
+    const accumulator<sha256>& context) NOEXCEPT
+  : base(sink), context_(context)
+{
+}
+
 template <data_t Tag, typename OStream>
 sha256t_writer<Tag, OStream>::~sha256t_writer() NOEXCEPT
 {
@@ -50,6 +57,13 @@ sha256t_writer<Tag, OStream>::~sha256t_writer() NOEXCEPT
     flusher();
 }
 
+// static
+template <data_t Tag, typename OStream>
+constexpr accumulator<sha256> sha256t_writer<Tag, OStream>::context() NOEXCEPT
+{
+    return { midstate(), one };
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+inline slab_writer::slab_writer(const data_slab& sink) NOEXCEPT
+  : begin_(sink.data()),
+    next_(begin_),
+    end_(std::next(begin_, sink.size())),
+    valid_(true)
+{
+}
+
+inline slab_writer::slab_writer(uint8_t* data, size_t size) NOEXCEPT
+  : slab_writer({ data, std::next(data, size) })
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline void slab_writer::write_big_endian(Integer value) NOEXCEPT
+{
+    const auto bytes = byte_cast(native_to_big_end(value));
+    write_bytes(std::next(bytes.data(), sizeof(Integer) - Size), Size);
+}
+
+inline void slab_writer::write_2_bytes_big_endian(uint16_t value) NOEXCEPT
+{
+    write_big_endian<uint16_t>(value);
+}
+
+inline void slab_writer::write_4_bytes_big_endian(uint32_t value) NOEXCEPT
+{
+    write_big_endian<uint32_t>(value);
+}
+
+inline void slab_writer::write_8_bytes_big_endian(uint64_t value) NOEXCEPT
+{
+    write_big_endian<uint64_t>(value);
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline void slab_writer::write_little_endian(Integer value) NOEXCEPT
+{
+    const auto bytes = byte_cast(native_to_little_end(value));
+    write_bytes(bytes.data(), Size);
+}
+
+inline void slab_writer::write_2_bytes_little_endian(uint16_t value) NOEXCEPT
+{
+    write_little_endian<uint16_t>(value);
+}
+
+inline void slab_writer::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    write_little_endian<uint32_t>(value);
+}
+
+inline void slab_writer::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    write_little_endian<uint64_t>(value);
+}
+
+inline void slab_writer::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_little_endian(narrow_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+inline void slab_writer::write_byte(uint8_t value) NOEXCEPT
+{
+    if (!limited(one))
+        *next_++ = value;
+}
+
+// buffers
+// ----------------------------------------------------------------------------
+
+inline void slab_writer::write_bytes(const data_slice& data) NOEXCEPT
+{
+    write_bytes(data.data(), data.size());
+}
+
+inline void slab_writer::write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    if (limited(size))
+        return;
+
+    std::copy_n(data, size, next_);
+    std::advance(next_, size);
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+inline void slab_writer::flush() NOEXCEPT
+{
+}
+
+inline size_t slab_writer::get_write_position() const NOEXCEPT
+{
+    return possible_narrow_sign_cast<size_t>(std::distance(begin_, next_));
+}
+
+inline slab_writer::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+inline bool slab_writer::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+inline size_t slab_writer::remaining() const NOEXCEPT
+{
+    return possible_narrow_sign_cast<size_t>(std::distance(next_, end_));
+}
+
+// The single bounds check of each field, invalidates if exceeded.
+inline bool slab_writer::limited(size_t size) NOEXCEPT
+{
+    if (valid_ && size <= remaining())
+        return false;
+
+    valid_ = false;
+    return true;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,377 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_IPP
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+inline slice_reader::slice_reader(const data_slice& source) NOEXCEPT
+  : slice_reader(source, bc::default_arena::get())
+{
+}
+
+inline slice_reader::slice_reader(const uint8_t* data, size_t size) NOEXCEPT
+  : slice_reader({ data, std::next(data, size) })
+{
+}
+
+inline slice_reader::slice_reader(const data_slice& source,
+    const memory_arena& arena) NOEXCEPT
+  : begin_(source.data()),
+    next_(begin_),
+    end_(std::next(begin_, source.size())),
+    limit_(end_),
+    valid_(true),
+    allocator_(arena)
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline Integer slice_reader::read_big_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    read_bytes(std::next(bytes.data(), sizeof(Integer) - Size), Size);
+    return native_from_big_end(value);
+}
+
+inline uint16_t slice_reader::read_2_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint16_t>();
+}
+
+inline uint32_t slice_reader::read_4_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint32_t>();
+}
+
+inline uint64_t slice_reader::read_8_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t>();
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline Integer slice_reader::read_little_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    read_bytes(bytes.data(), Size);
+    return native_from_little_end(value);
+}
+
+inline uint16_t slice_reader::read_2_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint16_t>();
+}
+
+inline uint32_t slice_reader::read_4_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint32_t>();
+}
+
+inline uint64_t slice_reader::read_8_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t>();
+}
+
+// The prefix (0xfd..0xff) selects value width and minimum from a table, so
+// the wide cases share one bounds check and one copy (no per-width branch).
+inline uint64_t slice_reader::read_variable() NOEXCEPT
+{
+    struct wide { size_t width; uint64_t minimum; };
+    static constexpr std::array<wide, 3> wides
+    {
+        wide{ sizeof(uint16_t), varint_two_bytes },
+        wide{ sizeof(uint32_t), add1<uint64_t>(max_uint16) },
+        wide{ sizeof(uint64_t), add1<uint64_t>(max_uint32) }
+    };
+
+    const auto prefix = read_byte();
+    if (prefix < varint_two_bytes)
+        return prefix;
+
+    const auto& wide = wides[prefix - varint_two_bytes];
+    if (limited(wide.width))
+        return {};
+
+    uint64_t value{};
+    std::copy_n(next_, wide.width, byte_cast(value).data());
+    std::advance(next_, wide.width);
+    value = native_from_little_end(value);
+
+    // Non-minimal encoding invalidates, as byte_reader.
+    if (value >= wide.minimum)
+        return value;
+
+    invalidate();
+    return {};
+}
+
+inline size_t slice_reader::read_size(size_t limit) NOEXCEPT
+{
+    const auto size = read_variable();
+
+    // This facilitates safely passing the size into a follow-on reader.
+    // Return zero allows follow-on use before testing reader state.
+    if (size > limit)
+    {
+        invalidate();
+        return {};
+    }
+
+    return possible_narrow_cast<size_t>(size);
+}
+
+inline uint8_t slice_reader::peek_byte() NOEXCEPT
+{
+    if (limited(one))
+        return {};
+
+    return *next_;
+}
+
+inline uint8_t slice_reader::read_byte() NOEXCEPT
+{
+    if (limited(one))
+        return {};
+
+    return *next_++;
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+inline data_array<Size> slice_reader::read_forward() NOEXCEPT
+{
+    // Truncated bytes are populated with 0x00.
+    data_array<Size> out{};
+    read_bytes(out.data(), Size);
+    return out;
+}
+
+template <size_t Size>
+inline data_array<Size> slice_reader::read_reverse() NOEXCEPT
+{
+    return system::reverse(read_forward<Size>());
+}
+
+inline short_hash slice_reader::read_short_hash() NOEXCEPT
+{
+    return read_forward<short_hash_size>();
+}
+
+inline hash_digest slice_reader::read_hash() NOEXCEPT
+{
+    return read_forward<hash_size>();
+}
+
+inline data_chunk slice_reader::read_bytes(size_t size) NOEXCEPT
+{
+    // This allows caller to read an invalid reader without allocation.
+    if (is_zero(size) || limited(size))
+        return {};
+
+    const auto start = next_;
+    std::advance(next_, size);
+    return { start, next_ };
+}
+
+inline void slice_reader::read_bytes(uint8_t* buffer, size_t size) NOEXCEPT
+{
+    // Truncated bytes are populated with 0x00 (buffer is not written).
+    if (limited(size))
+        return;
+
+    std::copy_n(next_, size, buffer);
+    std::advance(next_, size);
+}
+
+inline chunk_cptr slice_reader::read_bytes_cptr() NOEXCEPT
+{
+    return read_bytes_cptr(remaining());
+}
+
+inline chunk_cptr slice_reader::read_bytes_cptr(size_t size) NOEXCEPT
+{
+    // This allows caller to read an invalid reader without allocation.
+    if (limited(size))
+        return {};
+
+    const auto start = next_;
+    std::advance(next_, size);
+    const auto cptr = to_allocated<data_chunk>(get_arena(), start, next_);
+    if (!cptr)
+        invalidate();
+
+    return cptr;
+}
+
+inline data_slice slice_reader::read_slice(size_t size) NOEXCEPT
+{
+    if (limited(size))
+        return {};
+
+    const auto start = next_;
+    std::advance(next_, size);
+    return { start, next_ };
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+inline void slice_reader::skip_byte() NOEXCEPT
+{
+    skip_bytes(one);
+}
+
+inline void slice_reader::skip_bytes(size_t size) NOEXCEPT
+{
+    if (!limited(size))
+        std::advance(next_, size);
+}
+
+inline void slice_reader::skip_variable() NOEXCEPT
+{
+    read_variable();
+}
+
+inline void slice_reader::rewind_byte() NOEXCEPT
+{
+    rewind_bytes(one);
+}
+
+inline void slice_reader::rewind_bytes(size_t size) NOEXCEPT
+{
+    if (size > get_read_position())
+    {
+        invalidate();
+        return;
+    }
+
+    std::advance(next_, -possible_narrow_sign_cast<ptrdiff_t>(size));
+}
+
+inline bool slice_reader::is_exhausted() const NOEXCEPT
+{
+    return !valid_ || is_zero(remaining());
+}
+
+inline size_t slice_reader::get_read_position() const NOEXCEPT
+{
+    return possible_narrow_sign_cast<size_t>(std::distance(begin_, next_));
+}
+
+// Clears a presumed error state following a read overflow (as byte_reader).
+// A position beyond the end (or limit) invalidates, retaining the position.
+inline void slice_reader::set_position(size_t absolute) NOEXCEPT
+{
+    valid_ = true;
+    const auto position = get_read_position();
+
+    if (absolute > position)
+        skip_bytes(absolute - position);
+    else
+        rewind_bytes(position - absolute);
+}
+
+inline void slice_reader::set_limit() NOEXCEPT
+{
+    limit_ = end_;
+}
+
+// The limit is absolute, so is unaffected by subsequent skip or rewind.
+inline void slice_reader::set_limit(size_t size) NOEXCEPT
+{
+    const auto available = possible_narrow_sign_cast<size_t>(
+        std::distance(next_, end_));
+
+    limit_ = std::next(next_, std::min(size, available));
+}
+
+// Position is retained, and there are no further reads (as with byte_reader).
+inline void slice_reader::invalidate() NOEXCEPT
+{
+    valid_ = false;
+}
+
+inline slice_reader::memory_arena slice_reader::get_arena() const NOEXCEPT
+{
+    return allocator_.resource();
+}
+
+inline byte_allocator& slice_reader::get_allocator() const NOEXCEPT
+{
+    return allocator_;
+}
+
+inline slice_reader::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+inline bool slice_reader::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Bytes remaining before the limit (zero if rewound to before the limit).
+inline size_t slice_reader::remaining() const NOEXCEPT
+{
+    return next_ < limit_ ?
+        possible_narrow_sign_cast<size_t>(std::distance(next_, limit_)) : zero;
+}
+
+// The single bounds check of each field, invalidates if exceeded.
+inline bool slice_reader::limited(size_t size) NOEXCEPT
+{
+    if (valid_ && size <= remaining())
+        return false;
+
+    invalidate();
+    return true;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -43,6 +43,7 @@ namespace cpu1_0
     constexpr auto leaf = 1;
     constexpr auto subleaf = 0;
     constexpr auto sse41_ecx_bit = 19;
+    constexpr auto aes_ecx_bit = 25;
     constexpr auto xsave_ecx_bit = 27;
     constexpr auto avx_ecx_bit = 28;
 }
@@ -82,6 +83,14 @@ inline bool try_shani() NOEXCEPT
         && get_bit<cpu7_0::shani_ebx_bit>(ebx);     // SHA
 }
 
+inline bool try_aesni() NOEXCEPT
+{
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+        && get_bit<cpu1_0::sse41_ecx_bit>(ecx)      // SSE4.1
+        && get_bit<cpu1_0::aes_ecx_bit>(ecx);       // AES
+}
+
 inline bool try_avx512() NOEXCEPT
 {
     uint64_t extended{};
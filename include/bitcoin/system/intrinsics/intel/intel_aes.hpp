@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_INTRINSICS_INTEL_AES_HPP
+#define LIBBITCOIN_SYSTEM_INTRINSICS_INTEL_AES_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/types.hpp>
+#include <bitcoin/system/intrinsics/intel/intel.hpp>
+
+#if defined(HAVE_AESNI)
+
+namespace libbitcoin {
+namespace system {
+namespace aes {
+
+INLINE xint128_t load(const xint128_t& bytes) NOEXCEPT
+{
+    return _mm_loadu_si128(&bytes);
+}
+
+INLINE void store(xint128_t& bytes, xint128_t state) NOEXCEPT
+{
+    _mm_storeu_si128(&bytes, state);
+}
+
+INLINE xint128_t add_key(xint128_t state, xint128_t key) NOEXCEPT
+{
+    return _mm_xor_si128(state, key);
+}
+
+INLINE xint128_t encrypt(xint128_t state, xint128_t key) NOEXCEPT
+{
+    return _mm_aesenc_si128(state, key);
+}
+
+INLINE xint128_t encrypt_last(xint128_t state, xint128_t key) NOEXCEPT
+{
+    return _mm_aesenclast_si128(state, key);
+}
+
+INLINE xint128_t decrypt(xint128_t state, xint128_t key) NOEXCEPT
+{
+    return _mm_aesdec_si128(state, key);
+}
+
+INLINE xint128_t decrypt_last(xint128_t state, xint128_t key) NOEXCEPT
+{
+    return _mm_aesdeclast_si128(state, key);
+}
+
+INLINE xint128_t inverse_mix(xint128_t key) NOEXCEPT
+{
+    // Converts an encryption round key for use in equivalent decryption.
+    return _mm_aesimc_si128(key);
+}
+
+INLINE xint128_t accumulate(xint128_t key) NOEXCEPT
+{
+    // Prefix xor of the four key words (w[i] ^= w[i-1] ^ ... ^ w[i-4]).
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, _mm_slli_si128(key, 4));
+}
+
+template <int Rcon>
+INLINE xint128_t expand_even(xint128_t even, xint128_t odd) NOEXCEPT
+{
+    // RotWord(SubWord(w)) ^ Rcon, broadcast from the high word of odd.
+    const auto assist = _mm_aeskeygenassist_si128(odd, Rcon);
+    return _mm_xor_si128(accumulate(even), _mm_shuffle_epi32(assist, 0xff));
+}
+
+INLINE xint128_t expand_odd(xint128_t odd, xint128_t even) NOEXCEPT
+{
+    // SubWord(w) (no rotation, no Rcon), broadcast from the high word of even.
+    const auto assist = _mm_aeskeygenassist_si128(even, 0x00);
+    return _mm_xor_si128(accumulate(odd), _mm_shuffle_epi32(assist, 0xaa));
+}
+
+} // namespace aes
+} // namespace system
+} // namespace libbitcoin
+
+#endif // HAVE_AESNI
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_INTRINSICS_INTEL_HEX_HPP
+#define LIBBITCOIN_SYSTEM_INTRINSICS_INTEL_HEX_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/types.hpp>
+#include <bitcoin/system/intrinsics/intel/intel.hpp>
+
+// Base16 nibble-shuffle kernels. Digits are mapped through a 16 entry pshufb
+// table and decoded by range classification, with maddubs/packus combining
+// nibble pairs. Each kernel converts a fixed number of bytes (16 or 32).
+
+namespace libbitcoin {
+namespace system {
+namespace hex {
+
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+#if defined(HAVE_SSE4)
+
+INLINE xint128_t digits_128(xint128_t bytes, xint128_t table,
+    xint128_t mask) NOEXCEPT
+{
+    return _mm_shuffle_epi8(table, _mm_and_si128(bytes, mask));
+}
+
+INLINE void encode_128(char* out, xint128_t bytes) NOEXCEPT
+{
+    const auto table = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const auto mask = _mm_set1_epi8(0x0f);
+    const auto hi = digits_128(_mm_srli_epi16(bytes, 4), table, mask);
+    const auto lo = digits_128(bytes, table, mask);
+    const auto to = reinterpret_cast<xint128_t*>(out);
+    _mm_storeu_si128(&to[0], _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(&to[1], _mm_unpackhi_epi8(hi, lo));
+}
+
+// Encode 16 bytes to 32 characters.
+INLINE void encode_16(char* out, const uint8_t* in) NOEXCEPT
+{
+    encode_128(out, _mm_loadu_si128(reinterpret_cast<const xint128_t*>(in)));
+}
+
+// Encode 16 bytes to 32 characters, in reversed byte order.
+INLINE void encode_reversed_16(char* out, const uint8_t* in) NOEXCEPT
+{
+    const auto reverse = _mm_setr_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    encode_128(out, _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const xint128_t*>(in)), reverse));
+}
+
+// Nibble values of 16 characters, valid lanes set to 0xff.
+INLINE xint128_t nibbles_128(xint128_t& valid, xint128_t chars) NOEXCEPT
+{
+    const auto digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const auto alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+        _mm_set1_epi8('a'));
+    const auto is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit,
+        _mm_set1_epi8(9)), digit);
+    const auto is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha,
+        _mm_set1_epi8(5)), alpha);
+
+    valid = _mm_or_si128(is_digit, is_alpha);
+    return _mm_or_si128(_mm_and_si128(is_digit, digit),
+        _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+}
+
+// Decode 32 characters to 16 bytes, false if any character is not base16.
+INLINE bool decode_16(uint8_t* out, const char* in) NOEXCEPT
+{
+    const auto from = reinterpret_cast<const xint128_t*>(in);
+    const auto weights = _mm_set1_epi16(0x0110);
+    xint128_t valid0{}, valid1{};
+    const auto pairs0 = _mm_maddubs_epi16(nibbles_128(valid0,
+        _mm_loadu_si128(&from[0])), weights);
+    const auto pairs1 = _mm_maddubs_epi16(nibbles_128(valid1,
+        _mm_loadu_si128(&from[1])), weights);
+
+    _mm_storeu_si128(reinterpret_cast<xint128_t*>(out),
+        _mm_packus_epi16(pairs0, pairs1));
+    return _mm_movemask_epi8(_mm_and_si128(valid0, valid1)) == 0xffff;
+}
+
+#endif // HAVE_SSE4
+
+#if defined(HAVE_AVX2)
+
+INLINE xint256_t digits_256(xint256_t bytes, xint256_t table,
+    xint256_t mask) NOEXCEPT
+{
+    return _mm256_shuffle_epi8(table, _mm256_and_si256(bytes, mask));
+}
+
+INLINE void encode_256(char* out, xint256_t bytes) NOEXCEPT
+{
+    const auto table = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const auto mask = _mm256_set1_epi8(0x0f);
+    const auto hi = digits_256(_mm256_srli_epi16(bytes, 4), table, mask);
+    const auto lo = digits_256(bytes, table, mask);
+
+    // Unpack is within 128 bit lanes, so lanes are recombined in order.
+    const auto first = _mm256_unpacklo_epi8(hi, lo);
+    const auto second = _mm256_unpackhi_epi8(hi, lo);
+    const auto to = reinterpret_cast<xint256_t*>(out);
+    _mm256_storeu_si256(&to[0], _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256(&to[1], _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+// Encode 32 bytes to 64 characters.
+INLINE void encode_32(char* out, const uint8_t* in) NOEXCEPT
+{
+    encode_256(out, _mm256_loadu_si256(
+        reinterpret_cast<const xint256_t*>(in)));
+}
+
+// Encode 32 bytes to 64 characters, in reversed byte order.
+INLINE void encode_reversed_32(char* out, const uint8_t* in) NOEXCEPT
+{
+    const auto reverse = _mm256_setr_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const auto bytes = _mm256_shuffle_epi8(_mm256_loadu_si256(
+        reinterpret_cast<const xint256_t*>(in)), reverse);
+    encode_256(out, _mm256_permute4x64_epi64(bytes, 0x4e));
+}
+
+// Nibble values of 32 characters, valid lanes set to 0xff.
+INLINE xint256_t nibbles_256(xint256_t& valid, xint256_t chars) NOEXCEPT
+{
+    const auto digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    const auto alpha = _mm256_sub_epi8(_mm256_or_si256(chars,
+        _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const auto is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit,
+        _mm256_set1_epi8(9)), digit);
+    const auto is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha,
+        _mm256_set1_epi8(5)), alpha);
+
+    valid = _mm256_or_si256(is_digit, is_alpha);
+    return _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+        _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha,
+            _mm256_set1_epi8(10))));
+}
+
+// Decode 64 characters to 32 bytes, false if any character is not base16.
+INLINE bool decode_32(uint8_t* out, const char* in) NOEXCEPT
+{
+    const auto from = reinterpret_cast<const xint256_t*>(in);
+    const auto weights = _mm256_set1_epi16(0x0110);
+    xint256_t valid0{}, valid1{};
+    const auto pairs0 = _mm256_maddubs_epi16(nibbles_256(valid0,
+        _mm256_loadu_si256(&from[0])), weights);
+    const auto pairs1 = _mm256_maddubs_epi16(nibbles_256(valid1,
+        _mm256_loadu_si256(&from[1])), weights);
+
+    // Pack is within 128 bit lanes, so 64 bit quarters are reordered.
+    const auto packed = _mm256_packus_epi16(pairs0, pairs1);
+    _mm256_storeu_si256(reinterpret_cast<xint256_t*>(out),
+        _mm256_permute4x64_epi64(packed, 0xd8));
+    return _mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) == -1;
+}
+
+#endif // HAVE_AVX2
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace hex
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -26,11 +26,15 @@
 #include <bitcoin/system/intrinsics/intel/intel_128.hpp>
 #include <bitcoin/system/intrinsics/intel/intel_256.hpp>
 #include <bitcoin/system/intrinsics/intel/intel_512.hpp>
+#include <bitcoin/system/intrinsics/intel/intel_aes.hpp>
+#include <bitcoin/system/intrinsics/intel/intel_hex.hpp>
 #include <bitcoin/system/intrinsics/intel/intel_sha.hpp>
 #include <bitcoin/system/intrinsics/neon/neon.hpp>
 #include <bitcoin/system/intrinsics/neon/neon_128.hpp>
 #include <bitcoin/system/intrinsics/neon/neon_sha.hpp>
 #include <bitcoin/system/intrinsics/none/none_128.hpp>
+#include <bitcoin/system/intrinsics/none/none_aes.hpp>
+#include <bitcoin/system/intrinsics/none/none_hex.hpp>
 #include <bitcoin/system/intrinsics/none/none_sha.hpp>
 #include <bitcoin/system/intrinsics/rotate.hpp>
 #include <bitcoin/system/intrinsics/sve/sve.hpp>
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_INTRINSICS_NONE_AES_HPP
+#define LIBBITCOIN_SYSTEM_INTRINSICS_NONE_AES_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/types.hpp>
+
+#if !defined(HAVE_AES)
+
+namespace libbitcoin {
+namespace system {
+namespace aes {
+
+INLINE xint128_t load(const xint128_t& bytes) NOEXCEPT
+{
+    return bytes;
+}
+
+INLINE void store(xint128_t&, xint128_t) NOEXCEPT
+{
+}
+
+INLINE xint128_t add_key(xint128_t state, xint128_t) NOEXCEPT
+{
+    return state;
+}
+
+INLINE xint128_t encrypt(xint128_t state, xint128_t) NOEXCEPT
+{
+    return state;
+}
+
+INLINE xint128_t encrypt_last(xint128_t state, xint128_t) NOEXCEPT
+{
+    return state;
+}
+
+INLINE xint128_t decrypt(xint128_t state, xint128_t) NOEXCEPT
+{
+    return state;
+}
+
+INLINE xint128_t decrypt_last(xint128_t state, xint128_t) NOEXCEPT
+{
+    return state;
+}
+
+INLINE xint128_t inverse_mix(xint128_t key) NOEXCEPT
+{
+    return key;
+}
+
+template <int>
+INLINE xint128_t expand_even(xint128_t even, xint128_t) NOEXCEPT
+{
+    return even;
+}
+
+INLINE xint128_t expand_odd(xint128_t odd, xint128_t) NOEXCEPT
+{
+    return odd;
+}
+
+} // namespace aes
+} // namespace system
+} // namespace libbitcoin
+
+#endif // HAVE_AES
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_INTRINSICS_NONE_HEX_HPP
+#define LIBBITCOIN_SYSTEM_INTRINSICS_NONE_HEX_HPP
+
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace hex {
+
+#if !defined(HAVE_SSE4)
+
+INLINE void encode_16(char*, const uint8_t*) NOEXCEPT
+{
+}
+
+INLINE void encode_reversed_16(char*, const uint8_t*) NOEXCEPT
+{
+}
+
+INLINE bool decode_16(uint8_t*, const char*) NOEXCEPT
+{
+    return false;
+}
+
+#endif // HAVE_SSE4
+
+#if !defined(HAVE_AVX2)
+
+INLINE void encode_32(char*, const uint8_t*) NOEXCEPT
+{
+}
+
+INLINE void encode_reversed_32(char*, const uint8_t*) NOEXCEPT
+{
+}
+
+INLINE bool decode_32(uint8_t*, const char*) NOEXCEPT
+{
+    return false;
+}
+
+#endif // HAVE_AVX2
+
+} // namespace hex
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -24,13 +24,18 @@
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/script_cache.hpp>
+#include <bitcoin/system/machine/standard.hpp>
 
 namespace libbitcoin {
 namespace system {
 namespace machine {
 
 /// Class to isolate operation iteration, dispatch, and handlers from state.
-template <typename Stack, typename Program = program<Stack>>
+/// Threaded selects dispatch of a pre-decoded instruction array through a
+/// table of opcode handlers, otherwise operations are dispatched by switch.
+template <typename Stack, typename Program = program<Stack>,
+    bool Threaded = have_threaded_dispatch>
 class interpreter
   : public Program
 {
@@ -63,6 +68,16 @@ protected:
     using operation = chain::operation;
     using op_error_t = error::op_error_t;
 
+    /// Input script handler (uncached).
+    static code connect_input(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        const chain::signatures& capture) NOEXCEPT;
+
+    /// Input script handler (uncached, executes all scripts).
+    static code connect_program(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        const chain::signatures& capture) NOEXCEPT;
+
     /// Embedded script handler.
     static code connect_embedded(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it,
@@ -74,8 +89,47 @@ protected:
         const chain::script& prevout, bool embedded,
         const chain::signatures& capture) NOEXCEPT;
 
+    /// Pre-decoded instruction.
+    using handler = op_error_t(*)(interpreter&, const op_iterator&) NOEXCEPT;
+    struct instruction
+    {
+        /// Opcode handler, nullptr terminates the program.
+        handler execute;
+
+        /// Operation, for push data and subscript.
+        op_iterator op;
+
+        /// Index of next conditional or oversized operation (or terminator).
+        uint32_t skip;
+
+        /// Count of counted operations preceding this operation.
+        uint32_t counted;
+
+        bool conditional;
+        bool oversized;
+    };
+    using instructions = std::vector<instruction>;
+
+    /// Operation iteration.
+    code run_switch() NOEXCEPT;
+    code run_threaded() NOEXCEPT;
+
+    /// Pre-decode operations into a terminated instruction array (reused).
+    static void decode(instructions& program, const op_iterator& begin,
+        const op_iterator& end) NOEXCEPT;
+
     /// Operation disatch.
     virtual op_error_t run_op(const op_iterator& op) NOEXCEPT;
+    INLINE op_error_t execute(opcode code, const op_iterator& op) NOEXCEPT;
+
+    /// Opcode handler (code is constant, so execute reduces to one handler).
+    template <opcode Code>
+    static op_error_t dispatch(interpreter& self,
+        const op_iterator& op) NOEXCEPT;
+
+    /// Opcode handler table, indexed by opcode.
+    template <size_t... Code>
+    static consteval auto to_handlers(std::index_sequence<Code...>) NOEXCEPT;
 
     /// Operation handlers.
     virtual op_error_t op_unevaluated(opcode) const NOEXCEPT;
@@ -171,8 +225,8 @@ protected:
 } // namespace system
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Stack, typename Program>
-#define CLASS interpreter<Stack, Program>
+#define TEMPLATE template <typename Stack, typename Program, bool Threaded>
+#define CLASS interpreter<Stack, Program, Threaded>
 
 #include <bitcoin/system/impl/machine/interpreter.ipp>
 #include <bitcoin/system/impl/machine/interpreter_connect.ipp>
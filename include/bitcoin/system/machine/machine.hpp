@@ -25,6 +25,10 @@
 #include <bitcoin/system/machine/number_chunk.hpp>
 #include <bitcoin/system/machine/number_integer.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/script_cache.hpp>
 #include <bitcoin/system/machine/stack.hpp>
+#include <bitcoin/system/machine/stack_arena.hpp>
+#include <bitcoin/system/machine/stack_chunk.hpp>
+#include <bitcoin/system/machine/standard.hpp>
 
 #endif
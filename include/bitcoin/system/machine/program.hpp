@@ -101,6 +101,7 @@ protected:
     /// Primary stack (push).
     virtual INLINE void push_chunk(data_chunk&& datum) NOEXCEPT;
     virtual INLINE void push_chunk(const chunk_cptr& datum) NOEXCEPT;
+    virtual INLINE void push_inline(const stack_chunk& datum) NOEXCEPT;
     virtual INLINE void push_bool(bool value) NOEXCEPT;
     virtual INLINE void push_signed64(int64_t value) NOEXCEPT;
     virtual INLINE void push_length(size_t value) NOEXCEPT;
@@ -122,6 +123,7 @@ protected:
     virtual INLINE bool peek_unsigned32(uint32_t& value) const NOEXCEPT;
     virtual INLINE bool peek_unsigned40(uint64_t& value) const NOEXCEPT;
     virtual INLINE size_t peek_size() const NOEXCEPT;
+    virtual INLINE data_slice peek_slice_(stack_chunk& buffer) const NOEXCEPT;
 
     /// Primary stack (variant - index).
     virtual INLINE void swap_(size_t left_index, size_t right_index) NOEXCEPT;
@@ -235,6 +237,10 @@ private:
         const chunk_xptr& endorsement) NOEXCEPT;
 
     // Batching helpers.
+    inline bool verify_ecdsa_inline(const data_chunk& point,
+        const hash_digest& hash, const ec_signature& signature) const NOEXCEPT;
+    inline bool verify_schnorr_inline(const ec_xonly& point,
+        const hash_digest& hash, const ec_signature& signature) const NOEXCEPT;
     inline bool parse_ecdsa_multisig(hash_digest& hash, keys_array& keys,
         sigs_array& sigs, const chunk_xptrs& points,
         const chunk_xptrs& endorsements) const NOEXCEPT;
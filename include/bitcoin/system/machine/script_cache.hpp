@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_SCRIPT_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_SCRIPT_CACHE_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+namespace script_cache {
+
+/// Script execution cache
+/// ---------------------------------------------------------------------------
+/// A set of fully validated (wtxid, input index, flags) tuples, so that an
+/// input connected at pool acceptance is not evaluated again at block
+/// connect. The wtxid commits to all scripts and witnesses and, by outpoint,
+/// to the spent outputs. Entries are commitments in a salted_digest_set.
+/// Disabled by default, threading as key_cache.
+
+/// Enable with capacity for at least entries inputs, discarding any existing
+/// cache. Zero entries disables the cache.
+BC_API void enable(size_t entries) NOEXCEPT;
+
+/// Disable and free the cache.
+BC_API void disable() NOEXCEPT;
+
+/// True if the cache is enabled.
+BC_API bool enabled() NOEXCEPT;
+
+/// Hits, misses and entry capacity (lookups while disabled are not counted).
+BC_API digest_set::statistics get_statistics() NOEXCEPT;
+
+/// True if the input was previously validated under flags (false if
+/// disabled).
+BC_API bool has(const hash_digest& wtxid, uint32_t index,
+    uint32_t flags) NOEXCEPT;
+
+/// Record a fully validated input under flags (no-op if disabled).
+BC_API void put(const hash_digest& wtxid, uint32_t index,
+    uint32_t flags) NOEXCEPT;
+
+} // namespace script_cache
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -25,18 +25,22 @@
 #include <bitcoin/system/machine/number_boolean.hpp>
 #include <bitcoin/system/machine/number_chunk.hpp>
 #include <bitcoin/system/machine/number_integer.hpp>
+#include <bitcoin/system/machine/stack_arena.hpp>
+#include <bitcoin/system/machine/stack_chunk.hpp>
 
 namespace libbitcoin {
 namespace system {
 namespace machine {
 
 /// Primary and alternate stacks have variant elements.
-enum stack_type{ bool_, int64_, pchunk_ };
-typedef std::variant<bool, int64_t, chunk_xptr> stack_variant;
+/// Computed chunks (hashes) are held inline, pushed chunks by pointer.
+enum stack_type{ bool_, int64_, pchunk_, ichunk_ };
+typedef std::variant<bool, int64_t, chunk_xptr, stack_chunk> stack_variant;
 
 /// Primary stack options.
 typedef std::list<stack_variant> linked_stack;
 typedef std::vector<stack_variant> contiguous_stack;
+typedef std::vector<stack_variant, stack_allocator<stack_variant>> arena_stack;
 
 /// Alternate stack requires no stack<T> abstraction.
 typedef std::vector<stack_variant> alternate_stack;
@@ -68,6 +72,7 @@ public:
     virtual INLINE void emplace_boolean(bool value) NOEXCEPT;
     virtual INLINE void emplace_integer(int64_t value) NOEXCEPT;
     virtual INLINE void emplace_chunk(const chunk_xptr& value) NOEXCEPT;
+    virtual INLINE void emplace_inline(const stack_chunk& value) NOEXCEPT;
 
     /// Positional (stack cheats).
     virtual INLINE void erase(size_t index) NOEXCEPT;
@@ -84,6 +89,7 @@ public:
     virtual size_t peek_size() const NOEXCEPT;
     virtual size_t peek_nonempty() const NOEXCEPT;
     virtual chunk_xptr peek_chunk() const NOEXCEPT;
+    virtual data_slice peek_slice(stack_chunk& buffer) const NOEXCEPT;
     static bool equal_chunks(const stack_variant& left,
         const stack_variant& right) NOEXCEPT;
 
@@ -92,20 +98,24 @@ private:
         if_not_lesser<sizeof(Integer), Bytes> = true,
         if_signed_integral_integer<Integer> = true>
     bool peek_signed(Integer& value) const NOEXCEPT;
+    static data_slice to_slice(const stack_variant& element,
+        stack_chunk& buffer) NOEXCEPT;
 
     static constexpr auto linked_ = is_same_type<Container, linked_stack>;
-    static constexpr auto vector_ = is_same_type<Container, contiguous_stack>;
+    static constexpr auto vector_ = is_same_type<Container, contiguous_stack>
+        || is_same_type<Container, arena_stack>;
     static_assert(linked_ || vector_, "unsupported stack container");
 
     Container container_;
 
     // Tethering
     // -------------------------------------------------------------------------
-    // Hash results and int/bool->chunks are saved using a shared_ptr vector.
+    // Chunks pushed by value and int/bool->chunks read by pointer are saved
+    // using a shared_ptr vector. Hash results are held inline (stack_chunk).
     // The tether is not garbage-collected (until destruct) as this is a space-
     // time performance tradeoff. The maximum number of constructable chunks is
     // bound by the script size limit. A standard in/out script pair tethers
-    // only one chunk, the computed hash. Mutable as this is updated by read.
+    // no chunks. Mutable as this is updated by read.
     // -------------------------------------------------------------------------
     mutable tether<data_chunk> tether_;
 };
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_ARENA_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_STACK_ARENA_HPP
+
+#include <bitcoin/system/allocator.hpp>
+#include <bitcoin/system/arena.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Thread-local linear (bump) arena for script evaluation stacks.
+/// Allocation advances an offset within a fixed buffer, deallocation within
+/// the buffer is a nop, and start() resets the offset in constant time.
+/// Requests beyond the buffer fall through to the default arena. start() must
+/// not be called while stacks allocated since the prior start() remain live.
+class BC_API stack_arena final
+  : public arena
+{
+public:
+    static constexpr size_t capacity = 64u * 1024u;
+
+    /// The arena of the calling thread.
+    static stack_arena* get() NOEXCEPT;
+
+    /// Reset to and return buffer first address (baseline is ignored).
+    void* start(size_t baseline) NOEXCEPT override;
+
+    /// Return current allocation size (not detachable).
+    size_t detach() NOEXCEPT override;
+
+    /// Nop (not detachable).
+    void release(void* address) NOEXCEPT override;
+
+private:
+    void* do_allocate(size_t bytes, size_t align) THROWS override;
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override;
+    bool do_is_equal(const arena& other) const NOEXCEPT override;
+
+    alignas(max_align_t) std_array<uint8_t, capacity> buffer_{};
+    size_t offset_{};
+};
+
+/// Allocator that defaults to (and propagates on copy) the thread's stack
+/// arena, so that default constructed and copied stacks remain in the arena.
+template <class Value = uint8_t>
+class stack_allocator
+  : public allocator<Value>
+{
+public:
+    using value_type = Value;
+
+    template <class Type>
+    stack_allocator(const stack_allocator<Type>& other) NOEXCEPT
+      : allocator<Value>{ other.resource() }
+    {
+    }
+
+    stack_allocator() NOEXCEPT
+      : allocator<Value>{ stack_arena::get() }
+    {
+    }
+
+    stack_allocator(const stack_allocator&) = default;
+    stack_allocator& operator=(const stack_allocator&) = delete;
+
+    /// Copies are made in the stack arena of the calling thread.
+    stack_allocator select_on_container_copy_construction() const NOEXCEPT
+    {
+        return {};
+    }
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_CHUNK_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_STACK_CHUNK_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Small chunk held by value within a stack variant (no allocation).
+/// Capacity covers all computed hashes (20/32 bytes), compressed keys (33
+/// bytes) and all encodings of script numbers (at most 9 bytes).
+class BC_API stack_chunk
+{
+public:
+    static constexpr size_t capacity = add1(hash_size);
+
+    /// Minimal script number encodings, as number::chunk (no allocation).
+    static inline stack_chunk from_bool(bool vary) NOEXCEPT;
+    static inline stack_chunk from_integer(int64_t vary) NOEXCEPT;
+
+    /// Construct.
+    constexpr stack_chunk() NOEXCEPT;
+    template <size_t Size, if_not_greater<Size, capacity> = true>
+    constexpr stack_chunk(const data_array<Size>& data) NOEXCEPT;
+
+    /// Properties.
+    constexpr size_t size() const NOEXCEPT;
+    constexpr bool empty() const NOEXCEPT;
+    constexpr data_slice slice() const NOEXCEPT;
+    inline data_chunk to_chunk() const NOEXCEPT;
+
+    /// Operators.
+    constexpr bool operator==(const stack_chunk& other) const NOEXCEPT;
+
+private:
+    data_array<capacity> bytes_;
+    uint8_t size_;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/stack_chunk.ipp>
+
+#endif
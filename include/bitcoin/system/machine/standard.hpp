@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_STANDARD_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_STANDARD_HPP
+
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+namespace standard {
+
+/// Standard spend verification
+/// ---------------------------------------------------------------------------
+/// Direct verification of p2pkh, p2wpkh and p2tr (key path) spends, without
+/// construction of a program or execution of its scripts. Each implements the
+/// consensus semantics of interpreter::connect for its pattern, but returns
+/// true only for a valid spend. False does not imply an invalid spend, only
+/// that the input was not verified (the interpreter must then be used, which
+/// also produces the precise error code). Signatures are not captured for
+/// batching, but the signature cache is consulted and populated.
+
+using input_iterator = chain::input_cptrs::const_iterator;
+
+/// True if input spends a p2pkh prevout and is valid.
+BC_API bool verify_pay_key_hash(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+
+/// True if input spends a p2wpkh prevout and is valid.
+BC_API bool verify_pay_witness_key_hash(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+
+/// True if input spends a p2tr prevout by key path and is valid.
+BC_API bool verify_pay_taproot_key_path(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+
+/// True if input spends any of the above patterns and is valid.
+BC_API bool verify(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+
+} // namespace standard
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MONOTONIC_ARENA_HPP
+#define LIBBITCOIN_SYSTEM_MONOTONIC_ARENA_HPP
+
+#include <bitcoin/system/arena.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+
+/// Detachable linear (bump) arena, allocating from page-aligned slabs.
+/// Deallocation is a nop, all slabs are freed in one call by start() or the
+/// destructor, or detached for a subsequent release() by a new owner (such as
+/// a cache retaining a deserialized block). Not thread safe, use one instance
+/// per thread (see get()).
+class BC_API monotonic_arena final
+  : public arena
+{
+public:
+    DELETE_COPY_MOVE(monotonic_arena);
+
+    static constexpr size_t page_size = 4u * 1024u;
+    static constexpr size_t huge_page_size = 2u * 1024u * 1024u;
+    static constexpr size_t default_slab_size = 1024u * 1024u;
+
+    struct statistics
+    {
+        /// Bytes allocated since start() (including alignment padding).
+        size_t allocated;
+
+        /// Bytes of slabs owned (excludes detached slabs).
+        size_t reserved;
+
+        /// Greatest allocated bytes since construct.
+        size_t high_water;
+    };
+
+    /// The arena of the calling thread (default slab size, no huge pages).
+    static monotonic_arena* get() NOEXCEPT;
+
+    /// Slab size is rounded up to page (or huge page) size. Huge pages are
+    /// advised on linux, and otherwise only affect slab size and alignment.
+    monotonic_arena(size_t slab_size=default_slab_size,
+        bool huge_pages=false) NOEXCEPT;
+
+    /// Frees owned (not detached) slabs.
+    ~monotonic_arena() NOEXCEPT override;
+
+    /// Free owned slabs and allocate one of at least baseline bytes (or slab
+    /// size), returning the allocation's address for release (after detach).
+    void* start(size_t baseline) THROWS override;
+
+    /// Relinquish ownership of slabs, returning bytes allocated since start.
+    /// Memory remains valid until release(address) with address from start.
+    size_t detach() NOEXCEPT override;
+
+    /// Free the slabs of a detached allocation (address returned by start).
+    void release(void* address) NOEXCEPT override;
+
+    /// Allocation and high-water statistics.
+    statistics get_statistics() const NOEXCEPT;
+
+private:
+    struct slab
+    {
+        slab* next;
+        size_t size;
+    };
+
+    slab* push(size_t bytes) THROWS;
+    static void free_slabs(slab* first) NOEXCEPT;
+
+    void* do_allocate(size_t bytes, size_t align) THROWS override;
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override;
+    bool do_is_equal(const arena& other) const NOEXCEPT override;
+
+    // These are not thread safe.
+    const size_t slab_size_;
+    const bool huge_pages_;
+    slab* first_{};
+    slab* last_{};
+    size_t offset_{};
+    size_t allocated_{};
+    size_t reserved_{};
+    size_t high_water_{};
+};
+
+} // namespace libbitcoin
+
+#endif
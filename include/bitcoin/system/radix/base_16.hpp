@@ -41,6 +41,25 @@ constexpr bool is_base16(Byte character) NOEXCEPT;
 /// Byte value of the literal octet, undefined (but safe) if not base16.
 constexpr uint8_t encode_octet(const char(&string)[add1(octet_width)]) NOEXCEPT;
 
+/// Runtime conversion of contiguous memory, used by the constexpr functions
+/// below when not constant evaluated. Vectorized when built with sse4/avx2.
+/// Size is the number of bytes, and characters are (size * octet_width).
+/// ---------------------------------------------------------------------------
+
+/// Write hexidecimal characters of data to out.
+BC_API void encode_base16(char* out, const uint8_t* data, size_t size) NOEXCEPT;
+
+/// Write reversed byte order hexidecimal characters of data to out.
+BC_API void encode_hash(char* out, const uint8_t* data, size_t size) NOEXCEPT;
+
+/// Write bytes of hexidecimal characters to out.
+/// False if any character is not base16 (out is then unspecified).
+BC_API bool decode_base16(uint8_t* out, const char* in, size_t size) NOEXCEPT;
+
+/// Write bytes of reversed byte order hexidecimal characters to out.
+/// False if any character is not base16 (out is then unspecified).
+BC_API bool decode_hash(uint8_t* out, const char* in, size_t size) NOEXCEPT;
+
 /// Encoding of data_slice (e.g. data_array/data_chunk/string) to hex string.
 /// ---------------------------------------------------------------------------
 
@@ -54,17 +73,19 @@ constexpr std::string encode_hash(const data_slice& hash) NOEXCEPT;
 /// ---------------------------------------------------------------------------
 
 /// Convert a hexidecimal string to a byte vector.
-/// False if the input is malformed.
+/// False if the input is malformed (out is then cleared).
 constexpr bool decode_base16(data_chunk& out, const std::string_view& in) NOEXCEPT;
 
 /// Convert a hexidecimal string to a byte array.
 /// False if the input is malformed, or the wrong length.
+/// The array is unspecified if the input is malformed.
 template <size_t Size>
 constexpr bool decode_base16(data_array<Size>& out,
     const std::string_view& in) NOEXCEPT;
 
 /// Convert a reversed byte order hexidecimal string to a byte array.
 /// False if the input is malformed, or the wrong length.
+/// The array is unspecified if the input is malformed.
 template <size_t Size>
 constexpr bool decode_hash(data_array<Size>& out,
     const std::string_view& in) NOEXCEPT;
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_RADIX_BASE_32_HPP
 #define LIBBITCOIN_SYSTEM_RADIX_BASE_32_HPP
 
+#include <string_view>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 
@@ -75,12 +76,28 @@ BC_API std::string encode_base32(const base32_chunk& data) NOEXCEPT;
 /// False if mixed case or any character is not from the base32 character set.
 BC_API bool decode_base32(base32_chunk& out, const std::string& in) NOEXCEPT;
 
+/// Append 5 bit symbols (one per byte, upper bits ignored) as characters.
+BC_API void encode_base32_symbols(std::string& out,
+    const data_slice& symbols) NOEXCEPT;
+
+/// Convert a base32 string to 5 bit symbols (one per byte).
+/// False if mixed case or any character is not from the base32 character set.
+BC_API bool decode_base32_symbols(data_chunk& out,
+    const std::string_view& in) NOEXCEPT;
+
 /// Pack any vector of 5 bit bytes to vector of 8 bit bytes.
 BC_API data_chunk base32_pack(const base32_chunk& unpacked) NOEXCEPT;
 
 /// Unpack any vector of 8 bit bytes to a vector of 5 bit bytes.
 BC_API base32_chunk base32_unpack(const data_chunk& packed) NOEXCEPT;
 
+/// Pack 5 bit symbols (one per byte, upper bits ignored) to 8 bit bytes.
+/// False (and out cleared) if the trailing partial byte is not zero padding.
+BC_API bool base32_pack(data_chunk& out, const data_slice& unpacked) NOEXCEPT;
+
+/// Unpack 8 bit bytes to 5 bit symbols (one per byte), zero padded.
+BC_API void base32_unpack(data_chunk& out, const data_slice& packed) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -44,6 +44,14 @@ BC_API std::string encode_base58(const data_slice& unencoded) NOEXCEPT;
 /// False if the input contains non-base58 characters.
 BC_API bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT;
 
+/// Encode each data element as base58, reusing conversion scratch.
+BC_API string_list encode_base58_many(const data_stack& unencoded) NOEXCEPT;
+
+/// Attempt to decode each base58 string, reusing conversion scratch.
+/// False (and out cleared) if any input contains non-base58 characters.
+BC_API bool decode_base58_many(data_stack& out,
+    const string_list& in) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -47,6 +47,8 @@
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256t_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
 
 // Stream Exceptions:
 // ============================================================================
@@ -79,6 +81,9 @@ namespace read
 
         /// A byte reader that copies from a data_reference via std::istream.
         using copy = make_streamer<copy_source<data_reference>, byte_reader>;
+
+        /// A non-virtual byte reader of a data_slice (template Source only).
+        using slice = slice_reader;
     }
 
     namespace bits
@@ -119,6 +124,9 @@ namespace write
         /// A byte writer that copies to a data_slab via std::ostream.
         using copy = make_streamer<copy_sink<data_slab>, byte_writer>;
 
+        /// A non-virtual byte writer of a data_slab (template Sink only).
+        using slab = slab_writer;
+
         /// A byte writer that inserts into a container via std::ostream.
         template <typename Container>
         using push = make_streamer<push_sink<Container>, byte_writer>;
@@ -40,9 +40,15 @@ public:
     /// Constructors.
     sha256t_writer(OStream& sink) NOEXCEPT;
 
+    /// Continue from a context with accumulated (e.g. cached prefix) state.
+    sha256t_writer(OStream& sink, const accumulator<sha256>& context) NOEXCEPT;
+
     /// Flush on destruct.
     ~sha256t_writer() NOEXCEPT override;
 
+    /// Tag-initialized context, from which a prefix may be accumulated.
+    static constexpr accumulator<sha256> context() NOEXCEPT;
+
 protected:
     /// The maximum addressable stream position.
     static constexpr size_t maximum = hash_size;
@@ -40,6 +40,9 @@ public:
     /// Constructors.
     sha256x2_writer(OStream& sink) NOEXCEPT;
 
+    /// Continue from a context with accumulated (e.g. cached prefix) state.
+    sha256x2_writer(OStream& sink, const accumulator<sha256>& context) NOEXCEPT;
+
     /// Flush on destruct.
     ~sha256x2_writer() NOEXCEPT override;
 
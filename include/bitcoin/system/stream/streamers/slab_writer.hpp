@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A non-virtual byte writer to a contiguous buffer (no ostream).
+/// Members are a subset of byte_writer, with the same semantics, for use as a
+/// template Sink in place of write::bytes::fast. Each field is bounds checked
+/// once. Writing beyond the end invalidates the writer (and writes nothing).
+class slab_writer final
+{
+public:
+    DEFAULT_COPY_MOVE(slab_writer);
+
+    /// Constructors.
+    inline slab_writer(const data_slab& sink) NOEXCEPT;
+    inline slab_writer(uint8_t* data, size_t size) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Type-inferenced integer writers.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline void write_big_endian(Integer value) NOEXCEPT;
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline void write_little_endian(Integer value) NOEXCEPT;
+
+    /// Write big endian integers.
+    inline void write_2_bytes_big_endian(uint16_t value) NOEXCEPT;
+    inline void write_4_bytes_big_endian(uint32_t value) NOEXCEPT;
+    inline void write_8_bytes_big_endian(uint64_t value) NOEXCEPT;
+
+    /// Write little endian integers.
+    inline void write_2_bytes_little_endian(uint16_t value) NOEXCEPT;
+    inline void write_4_bytes_little_endian(uint32_t value) NOEXCEPT;
+    inline void write_8_bytes_little_endian(uint64_t value) NOEXCEPT;
+
+    /// Write Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline void write_variable(uint64_t value) NOEXCEPT;
+
+    /// Write one byte.
+    inline void write_byte(uint8_t value) NOEXCEPT;
+
+    /// Buffers.
+    /// -----------------------------------------------------------------------
+
+    /// Write all bytes (copied in bulk).
+    inline void write_bytes(const data_slice& data) NOEXCEPT;
+
+    /// Write size bytes (copied in bulk).
+    inline void write_bytes(const uint8_t* data, size_t size) NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Flush the buffer (no-op, writes are direct).
+    inline void flush() NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_write_position() const NOEXCEPT;
+
+    /// The writer is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The writer is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline size_t remaining() const NOEXCEPT;
+    inline bool limited(size_t size) NOEXCEPT;
+
+    uint8_t* begin_;
+    uint8_t* next_;
+    uint8_t* end_;
+    bool valid_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/slab_writer.ipp>
+
+#endif
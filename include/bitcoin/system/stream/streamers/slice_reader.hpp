@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_HPP
+
+#include <bitcoin/system/allocator.hpp>
+#include <bitcoin/system/arena.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A non-virtual byte reader of a contiguous buffer (no istream).
+/// Members are a subset of byte_reader, with the same semantics, for use as a
+/// template Source in place of read::bytes::fast. Each field is bounds checked
+/// once. Reading beyond the end invalidates the reader and returns zeros.
+class slice_reader final
+{
+public:
+    DEFAULT_COPY_MOVE(slice_reader);
+    using memory_arena = arena*;
+
+    /// Constructors.
+    inline slice_reader(const data_slice& source) NOEXCEPT;
+    inline slice_reader(const uint8_t* data, size_t size) NOEXCEPT;
+    inline slice_reader(const data_slice& source,
+        const memory_arena& arena) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Read integer, size determined from parameter type.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline Integer read_big_endian() NOEXCEPT;
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline Integer read_little_endian() NOEXCEPT;
+
+    /// Read big endian (explicit specializations of read_big_endian).
+    inline uint16_t read_2_bytes_big_endian() NOEXCEPT;
+    inline uint32_t read_4_bytes_big_endian() NOEXCEPT;
+    inline uint64_t read_8_bytes_big_endian() NOEXCEPT;
+
+    /// Little endian integer readers (specializations of read_little_endian).
+    inline uint16_t read_2_bytes_little_endian() NOEXCEPT;
+    inline uint32_t read_4_bytes_little_endian() NOEXCEPT;
+    inline uint64_t read_8_bytes_little_endian() NOEXCEPT;
+
+    /// Read Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline uint64_t read_variable() NOEXCEPT;
+
+    /// Cast read_variable to size_t, facilitates read_bytes(read_size()).
+    /// Returns zero and invalidates reader if would exceed read limit.
+    inline size_t read_size(size_t limit=max_size_t) NOEXCEPT;
+
+    /// Read/peek one byte (invalidates an empty reader).
+    inline uint8_t peek_byte() NOEXCEPT;
+    inline uint8_t read_byte() NOEXCEPT;
+
+    /// Bytes.
+    /// -----------------------------------------------------------------------
+
+    /// Read size bytes into array (copied in bulk).
+    template <size_t Size>
+    inline data_array<Size> read_forward() NOEXCEPT;
+    template <size_t Size>
+    inline data_array<Size> read_reverse() NOEXCEPT;
+
+    /// Read hash to stack allocated forwarded object.
+    inline short_hash read_short_hash() NOEXCEPT;
+    inline hash_digest read_hash() NOEXCEPT;
+
+    /// Read size bytes to data_chunk (empty if invalid or would exceed).
+    inline data_chunk read_bytes(size_t size) NOEXCEPT;
+
+    /// Read size bytes to buffer (unwritten if invalid or would exceed).
+    inline void read_bytes(uint8_t* buffer, size_t size) NOEXCEPT;
+
+    /// Read all remaining bytes to chunk allocated by the arena.
+    inline chunk_cptr read_bytes_cptr() NOEXCEPT;
+
+    /// Read size bytes to chunk allocated by the arena (nullptr if invalid or
+    /// would exceed).
+    inline chunk_cptr read_bytes_cptr(size_t size) NOEXCEPT;
+
+    /// Reference size bytes in place (empty if invalid or would exceed).
+    inline data_slice read_slice(size_t size) NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Advance the iterator.
+    inline void skip_byte() NOEXCEPT;
+    inline void skip_bytes(size_t size) NOEXCEPT;
+
+    /// Read one variable integer and advance the iterator accordingly.
+    inline void skip_variable() NOEXCEPT;
+
+    /// Rewind the iterator.
+    inline void rewind_byte() NOEXCEPT;
+    inline void rewind_bytes(size_t size) NOEXCEPT;
+
+    /// The reader is empty (or invalid).
+    inline bool is_exhausted() const NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_read_position() const NOEXCEPT;
+
+    /// Clear invalid state and set absolute position.
+    inline void set_position(size_t absolute) NOEXCEPT;
+
+    /// Unlimit reader upper bound.
+    inline void set_limit() NOEXCEPT;
+
+    /// Limit reader upper bound to current position plus size.
+    inline void set_limit(size_t size) NOEXCEPT;
+
+    /// Invalidate the reader.
+    inline void invalidate() NOEXCEPT;
+
+    /// Memory resource used to populate vectors.
+    inline memory_arena get_arena() const NOEXCEPT;
+
+    /// Memory allocator used to construct objects.
+    inline byte_allocator& get_allocator() const NOEXCEPT;
+
+    /// The reader is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The reader is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline size_t remaining() const NOEXCEPT;
+    inline bool limited(size_t size) NOEXCEPT;
+
+    const uint8_t* begin_;
+    const uint8_t* next_;
+    const uint8_t* end_;
+    const uint8_t* limit_;
+    bool valid_;
+    mutable byte_allocator allocator_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/slice_reader.ipp>
+
+#endif
@@ -19,7 +19,9 @@
 #include <bitcoin/system/chain/block.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <mutex>
 #include <numeric>
 #include <ranges>
 #include <set>
@@ -72,7 +74,7 @@ block::block(const chain::header::cptr& header,
 }
 
 block::block(const data_slice& data, bool witness) NOEXCEPT
-  : block(stream::in::fast(data), witness)
+  : block(slice_reader(data), witness)
 {
 }
 
@@ -103,6 +105,17 @@ block::block(reader& source, bool witness) NOEXCEPT
 {
 }
 
+// protected
+block::block(slice_reader&& source, bool witness) NOEXCEPT
+  : block(source, witness)
+{
+}
+
+block::block(slice_reader& source, bool witness) NOEXCEPT
+  : block(from_data(source, witness))
+{
+}
+
 // protected
 block::block(const chain::header::cptr& header,
     const transactions_cptr& txs, bool valid) NOEXCEPT
@@ -131,16 +144,20 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private/static
-block block::from_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+block block::from_data(Source& source, bool witness) NOEXCEPT
 {
-    const auto read_transactions = [witness](reader& source) NOEXCEPT
+    const auto read_transactions = [witness](Source& source) NOEXCEPT
     {
-        auto txs = to_shared<transaction_cptrs>();
+        const auto& allocator = source.get_allocator();
+        auto txs = to_allocated<transaction_cptrs>(allocator);
         const auto count = source.read_size(max_count);
-        txs->reserve(count);
+        const auto ptr = to_non_const_raw_ptr(txs);
+        ptr->reserve(count);
 
         for (size_t tx{}; tx < count; ++tx)
-            txs->push_back(to_shared<transaction>(source, witness));
+            ptr->push_back(to_allocated<transaction>(allocator, source,
+                witness));
 
         // This is a pointer copy (non-const to const).
         return txs;
@@ -148,7 +165,7 @@ block block::from_data(reader& source, bool witness) NOEXCEPT
 
     return
     {
-        to_shared<chain::header>(source),
+        to_allocated<chain::header>(source.get_allocator(), source),
         read_transactions(source),
         source
     };
@@ -404,7 +421,7 @@ bool block::is_forward_reference() const NOEXCEPT
     if (txs_->empty())
         return false;
 
-    unordered_set_of_hash_cref hashes(sub1(txs_->size()));
+    flat_set_of_hash_cref hashes(sub1(txs_->size()));
     for (auto tx = txs_->rbegin(); tx != std::prev(txs_->rend()); ++tx)
     {
         for (const auto& in: *(*tx)->inputs_ptr())
@@ -425,10 +442,10 @@ bool block::is_internal_double_spend() const NOEXCEPT
     if (txs_->empty())
         return false;
 
-    unordered_set_of_point_cref points(spends());
+    flat_set_of_point_cref points(spends());
     for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
         for (const auto& in: *(*tx)->inputs_ptr())
-            if (!points.emplace(in->point()).second)
+            if (!points.emplace(in->point()))
                 return true;
 
     return false;
@@ -509,7 +526,7 @@ bool block::is_hash_limit_exceeded() const NOEXCEPT
         return false;
 
     // A set is used to collapse duplicates.
-    unordered_set_of_hash_cref hashes(txs_->size());
+    flat_set_of_hash_cref hashes(ceilinged_add(txs_->size(), spends()));
 
     // Just the coinbase tx hash, skip its null input hashes.
     hashes.emplace(txs_->front()->get_hash(false));
@@ -985,6 +1002,76 @@ code block::connect(const context& ctx,
     return connect_transactions(ctx, capture);
 }
 
+// This assumes that prevout caching is completed on all inputs.
+code block::connect_all(const context& ctx, size_t& tx_index,
+    uint32_t& input_index, bool turbo) const NOEXCEPT
+{
+    struct position
+    {
+        size_t tx;
+        uint32_t in;
+    };
+
+    // Flatten to inputs (in block order), failing on first missing prevout.
+    std::vector<position> positions{};
+    positions.reserve(spends());
+    for (size_t tx = one; tx < txs_->size(); ++tx)
+    {
+        const auto& inputs = *txs_->at(tx)->inputs_ptr();
+        for (uint32_t in = 0; in < inputs.size(); ++in)
+        {
+            if (!inputs.at(in)->prevout)
+            {
+                tx_index = tx;
+                input_index = in;
+                return error::missing_previous_output;
+            }
+
+            positions.push_back({ tx, in });
+        }
+    }
+
+    // Signature hash caches are lazily set, which is not thread safe.
+    if (turbo)
+        for (size_t tx = one; tx < txs_->size(); ++tx)
+            if (txs_->at(tx)->inputs_ptr()->size() > one)
+                txs_->at(tx)->set_signature_hashes();
+
+    const auto policy = poolstl::execution::par_if(turbo);
+    const signatures capture{};
+    std::vector<size_t> ordinals(positions.size());
+    std::iota(ordinals.begin(), ordinals.end(), zero);
+    code result{ error::block_success };
+    std::atomic_size_t lowest{ max_size_t };
+    std::mutex mutex{};
+
+    // Inputs below the lowest failure are always connected, so the reported
+    // failure is the first (deterministic). The lock is taken only on failure.
+    std::for_each(policy, ordinals.cbegin(), ordinals.cend(),
+        [&](size_t ordinal) NOEXCEPT
+        {
+            if (ordinal > lowest.load(std::memory_order_relaxed))
+                return;
+
+            const auto& at = positions.at(ordinal);
+            const auto& tx = *txs_->at(at.tx);
+            const auto it = std::next(tx.inputs_ptr()->begin(), at.in);
+            if (const auto ec = tx.connect_input(ctx, it, capture))
+            {
+                const std::unique_lock lock{ mutex };
+                if (ordinal < lowest.load(std::memory_order_relaxed))
+                {
+                    result = ec;
+                    tx_index = at.tx;
+                    input_index = at.in;
+                    lowest.store(ordinal, std::memory_order_relaxed);
+                }
+            }
+        });
+
+    return result;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
@@ -61,7 +61,7 @@ header::header(uint32_t version, const hash_digest& previous_block_hash,
 }
 
 header::header(const data_slice& data) NOEXCEPT
-  : header(stream::in::fast(data))
+  : header(slice_reader(data))
 {
 }
 
@@ -92,6 +92,17 @@ header::header(reader& source) NOEXCEPT
 {
 }
 
+// protected
+header::header(slice_reader&& source) NOEXCEPT
+  : header(source)
+{
+}
+
+header::header(slice_reader& source) NOEXCEPT
+  : header(from_data(source))
+{
+}
+
 // protected
 header::header(uint32_t version, hash_digest&& previous_block_hash,
     hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -142,7 +153,8 @@ bool header::operator!=(const header& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-header header::from_data(reader& source) NOEXCEPT
+template <typename Source>
+header header::from_data(Source& source) NOEXCEPT
 {
     return
     {
@@ -159,12 +171,12 @@ header header::from_data(reader& source) NOEXCEPT
 // Serialization.
 // ----------------------------------------------------------------------------
 
+// Fixed size, so written directly to the chunk (non-virtual writer).
 data_chunk header::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
-    to_data(out);
+    write::bytes::slab out(data);
+    write_data(out);
     return data;
 }
 
@@ -175,6 +187,13 @@ void header::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void header::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void header::write_data(Sink& sink) const NOEXCEPT
 {
     sink.write_4_bytes_little_endian(version_);
     sink.write_bytes(previous_block_hash_);
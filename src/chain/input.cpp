@@ -140,7 +140,7 @@ input::input(const chain::point::cptr& point, const chain::script::cptr& script,
 }
 
 input::input(const data_slice& data) NOEXCEPT
-  : input(stream::in::fast(data))
+  : input(slice_reader(data))
 {
 }
 
@@ -172,6 +172,17 @@ input::input(reader& source) NOEXCEPT
 {
 }
 
+// protected
+input::input(slice_reader&& source) NOEXCEPT
+  : input(source)
+{
+}
+
+input::input(slice_reader& source) NOEXCEPT
+  : input(from_data(source))
+{
+}
+
 // protected
 input::input(const chain::point::cptr& point, const chain::script::cptr& script,
     const chain::witness::cptr& witness, uint32_t sequence, bool valid) NOEXCEPT
@@ -225,14 +236,15 @@ bool operator!=(const cref_point& left, const cref_point& right) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-input input::from_data(reader& source) NOEXCEPT
+template <typename Source>
+input input::from_data(Source& source) NOEXCEPT
 {
     // Witness is deserialized by transaction.
     return
     {
-        to_shared<chain::point>(source),
-        to_shared<chain::script>(source, true),
-        to_shared<chain::witness>(),
+        to_allocated<chain::point>(source.get_allocator(), source),
+        to_allocated<chain::script>(source.get_allocator(), source, true),
+        to_allocated<chain::witness>(source.get_allocator()),
         source.read_4_bytes_little_endian(),
         source
     };
@@ -325,7 +337,20 @@ size_t input::witnessed_size() const NOEXCEPT
 // true implies non-empty (for superfluous check), source returns error state.
 bool input::set_witness(reader& source) NOEXCEPT
 {
-    witness_ = to_shared<chain::witness>(source, true);
+    return set_witness(to_allocated<chain::witness>(source.get_allocator(),
+        source, true));
+}
+
+bool input::set_witness(slice_reader& source) NOEXCEPT
+{
+    return set_witness(to_allocated<chain::witness>(source.get_allocator(),
+        source, true));
+}
+
+// private
+bool input::set_witness(const chain::witness::cptr& witness) NOEXCEPT
+{
+    witness_ = witness;
     size_.witnessed = ceilinged_add(size_.nominal,
         witness_->serialized_size(true));
 
@@ -0,0 +1,545 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/json/writer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <string_view>
+#include <bitcoin/system/chain/enums/flags.hpp>
+#include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/chain/views/script_view.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+namespace {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Text is accumulated in a stack buffer, which is flushed to the sink when
+// full, so the sink (virtual) is called once per buffer, not once per token.
+// Script and witness text are limited to [0-9a-z_.-[]() ?] characters, and
+// all other strings are hexadecimal, so a json escape is never required.
+class emitter
+{
+public:
+    DELETE_COPY_MOVE(emitter);
+
+    emitter(writer& sink) NOEXCEPT
+      : sink_(sink)
+    {
+    }
+
+    ~emitter() NOEXCEPT
+    {
+        flush();
+    }
+
+    inline void put(char character) NOEXCEPT
+    {
+        reserve(one);
+        buffer_[size_++] = character;
+    }
+
+    inline void put(const std::string_view& text) NOEXCEPT
+    {
+        if (text.size() > capacity)
+        {
+            flush();
+            sink_.write_bytes(pointer_cast<const uint8_t>(text.data()),
+                text.size());
+            return;
+        }
+
+        reserve(text.size());
+        std::copy(text.begin(), text.end(), &buffer_[size_]);
+        size_ += text.size();
+    }
+
+    inline void number(uint64_t value) NOEXCEPT
+    {
+        constexpr auto digits = 20u;
+        reserve(digits);
+        const auto end = std::next(buffer_.data(), capacity);
+        const auto result = std::to_chars(&buffer_[size_], end, value);
+        size_ = possible_narrow_sign_cast<size_t>(
+            std::distance(buffer_.data(), result.ptr));
+    }
+
+    inline void base16(const data_slice& data) NOEXCEPT
+    {
+        auto bytes = data.data();
+        auto size = data.size();
+        while (!is_zero(size))
+        {
+            reserve(two);
+            const auto count = std::min(size, (capacity - size_) / two);
+            encode_base16(&buffer_[size_], bytes, count);
+            size_ += two * count;
+            bytes += count;
+            size -= count;
+        }
+    }
+
+    inline void hash(const uint8_t* digest) NOEXCEPT
+    {
+        reserve(two * hash_size);
+        encode_hash(&buffer_[size_], digest, hash_size);
+        size_ += two * hash_size;
+    }
+
+    inline void flush() NOEXCEPT
+    {
+        if (is_zero(size_))
+            return;
+
+        sink_.write_bytes(pointer_cast<const uint8_t>(buffer_.data()), size_);
+        size_ = zero;
+    }
+
+private:
+    static constexpr size_t capacity = 4096;
+
+    inline void reserve(size_t size) NOEXCEPT
+    {
+        if (size > capacity - size_)
+            flush();
+    }
+
+    writer& sink_;
+    size_t size_{};
+    std::array<char, capacity> buffer_;
+};
+
+// Mirrors operation::to_string(flags::all_rules), without allocation of the
+// operation or its text (excepting the opcode mnemonic).
+void emit_operation(emitter& out, opcode code, const data_slice& data,
+    bool underflow) NOEXCEPT
+{
+    if (underflow)
+    {
+        out.put('(');
+        out.base16(data);
+        out.put(')');
+        return;
+    }
+
+    if (data.empty())
+    {
+        out.put(opcode_to_mnemonic(code, flags::all_rules));
+        return;
+    }
+
+    out.put('[');
+    out.put(operation::opcode_to_prefix(code, data.size()));
+    out.base16(data);
+    out.put(']');
+}
+
+void emit_element(emitter& out, const data_slice& element,
+    bool first) NOEXCEPT
+{
+    out.put(first ? "[" : " [");
+    out.base16(element);
+    out.put(']');
+}
+
+void emit_point(emitter& out, const uint8_t* hash, uint32_t index) NOEXCEPT
+{
+    out.put(R"({"hash":")");
+    out.hash(hash);
+    out.put(R"(","index":)");
+    out.number(index);
+    out.put('}');
+}
+
+// Objects.
+// ----------------------------------------------------------------------------
+
+void emit(emitter& out, const script& instance) NOEXCEPT
+{
+    auto first = true;
+    out.put('"');
+    for (const auto& op: instance.ops())
+    {
+        if (!first)
+            out.put(' ');
+
+        if (op.is_valid())
+            emit_operation(out, op.code(), op.data(), op.is_underflow());
+        else
+            out.put('?');
+
+        first = false;
+    }
+
+    out.put('"');
+}
+
+void emit(emitter& out, const witness& instance) NOEXCEPT
+{
+    if (!instance.is_valid())
+    {
+        out.put("\"(?)\"");
+        return;
+    }
+
+    auto first = true;
+    out.put('"');
+    for (const auto& element: instance.stack())
+    {
+        emit_element(out, *element, first);
+        first = false;
+    }
+
+    out.put('"');
+}
+
+void emit(emitter& out, const point& instance) NOEXCEPT
+{
+    emit_point(out, instance.hash().data(), instance.index());
+}
+
+void emit(emitter& out, const input& instance) NOEXCEPT
+{
+    out.put(R"({"point":)");
+    emit(out, instance.point());
+    out.put(R"(,"script":)");
+    emit(out, instance.script());
+
+    if (instance.witness().is_valid())
+    {
+        out.put(R"(,"witness":)");
+        emit(out, instance.witness());
+    }
+
+    out.put(R"(,"sequence":)");
+    out.number(instance.sequence());
+    out.put('}');
+}
+
+void emit(emitter& out, const output& instance) NOEXCEPT
+{
+    out.put(R"({"value":)");
+    out.number(instance.value());
+    out.put(R"(,"script":)");
+    emit(out, instance.script());
+    out.put('}');
+}
+
+void emit(emitter& out, const transaction& instance) NOEXCEPT
+{
+    out.put(R"({"hash":")");
+    out.hash(instance.hash(false).data());
+    out.put(R"(","version":)");
+    out.number(instance.version());
+
+    auto first = true;
+    out.put(R"(,"inputs":[)");
+    for (const auto& in: *instance.inputs_ptr())
+    {
+        if (!first)
+            out.put(',');
+
+        emit(out, *in);
+        first = false;
+    }
+
+    first = true;
+    out.put(R"(],"outputs":[)");
+    for (const auto& output: *instance.outputs_ptr())
+    {
+        if (!first)
+            out.put(',');
+
+        emit(out, *output);
+        first = false;
+    }
+
+    out.put(R"(],"locktime":)");
+    out.number(instance.locktime());
+    out.put('}');
+}
+
+void emit(emitter& out, const header& instance) NOEXCEPT
+{
+    out.put(R"({"hash":")");
+    out.hash(instance.hash().data());
+    out.put(R"(","version":)");
+    out.number(instance.version());
+    out.put(R"(,"previous":")");
+    out.hash(instance.previous_block_hash().data());
+    out.put(R"(","merkle_root":")");
+    out.hash(instance.merkle_root().data());
+    out.put(R"(","timestamp":)");
+    out.number(instance.timestamp());
+    out.put(R"(,"bits":)");
+    out.number(instance.bits());
+    out.put(R"(,"nonce":)");
+    out.number(instance.nonce());
+    out.put('}');
+}
+
+void emit(emitter& out, const block& instance) NOEXCEPT
+{
+    out.put(R"({"header":)");
+    emit(out, instance.header());
+
+    auto first = true;
+    out.put(R"(,"transactions":[)");
+    for (const auto& tx: *instance.transactions_ptr())
+    {
+        if (!first)
+            out.put(',');
+
+        emit(out, *tx);
+        first = false;
+    }
+
+    out.put("]}");
+}
+
+// Views.
+// ----------------------------------------------------------------------------
+// Fields are read in place from the block buffer, and written in the order of
+// the corresponding object (above). An invalid view is written as the default
+// (invalid) object.
+
+void emit_script(emitter& out, const data_slice& script) NOEXCEPT
+{
+    const auto end = std::next(script.data(), script.size());
+    const script_view::const_iterator last{ end, end };
+
+    auto first = true;
+    out.put('"');
+    for (script_view::const_iterator op{ script.data(), end }; op != last;
+        ++op)
+    {
+        if (!first)
+            out.put(' ');
+
+        emit_operation(out, op->code, op->data, op->underflow);
+        first = false;
+    }
+
+    out.put('"');
+}
+
+void emit_witness(emitter& out, read::bytes::slice& source) NOEXCEPT
+{
+    auto first = true;
+    const auto count = source.read_size();
+    out.put('"');
+    for (size_t element{}; element < count && source; ++element)
+    {
+        emit_element(out, source.read_slice(source.read_size()), first);
+        first = false;
+    }
+
+    out.put('"');
+}
+
+void emit(emitter& out, const transaction_view& instance) NOEXCEPT
+{
+    // An invalid view does not reference the buffer, so write as invalid tx.
+    if (!instance.is_valid())
+    {
+        emit(out, transaction{});
+        return;
+    }
+
+    out.put(R"({"hash":")");
+    out.hash(instance.hash(false).data());
+    out.put(R"(","version":)");
+    out.number(instance.version());
+
+    // Witnesses are only populated for a segregated (and unstripped) view.
+    const auto segregated = instance.is_segregated();
+    read::bytes::slice ins{ instance.get_inputs_slice() };
+    read::bytes::slice witnesses{ segregated ?
+        instance.get_witnesses_slice() : data_slice{} };
+
+    out.put(R"(,"inputs":[)");
+    for (size_t in_index{}; in_index < instance.inputs(); ++in_index)
+    {
+        if (!is_zero(in_index))
+            out.put(',');
+
+        out.put(R"({"point":)");
+        const auto prevout = ins.read_slice(point::serialized_size());
+        emit_point(out, prevout.data(), unsafe_from_little_endian<uint32_t>(
+            std::next(prevout.data(), hash_size)));
+        out.put(R"(,"script":)");
+        emit_script(out, ins.read_slice(ins.read_size()));
+
+        if (segregated)
+        {
+            out.put(R"(,"witness":)");
+            emit_witness(out, witnesses);
+        }
+
+        out.put(R"(,"sequence":)");
+        out.number(ins.read_4_bytes_little_endian());
+        out.put('}');
+    }
+
+    read::bytes::slice outs{ instance.get_outputs_slice() };
+    out.put(R"(],"outputs":[)");
+    for (size_t out_index{}; out_index < instance.outputs(); ++out_index)
+    {
+        if (!is_zero(out_index))
+            out.put(',');
+
+        out.put(R"({"value":)");
+        out.number(outs.read_8_bytes_little_endian());
+        out.put(R"(,"script":)");
+        emit_script(out, outs.read_slice(outs.read_size()));
+        out.put('}');
+    }
+
+    out.put(R"(],"locktime":)");
+    out.number(instance.locktime());
+    out.put('}');
+}
+
+void emit(emitter& out, const block_view& instance) NOEXCEPT
+{
+    // The buffer of an invalid view may not contain a header.
+    if (!instance.is_valid())
+    {
+        emit(out, block{});
+        return;
+    }
+
+    read::bytes::slice head{ instance.header_slice() };
+    const auto version = head.read_4_bytes_little_endian();
+    const auto previous = head.read_slice(hash_size);
+    const auto merkle_root = head.read_slice(hash_size);
+
+    out.put(R"({"header":{"hash":")");
+    out.hash(instance.hash().data());
+    out.put(R"(","version":)");
+    out.number(version);
+    out.put(R"(,"previous":")");
+    out.hash(previous.data());
+    out.put(R"(","merkle_root":")");
+    out.hash(merkle_root.data());
+    out.put(R"(","timestamp":)");
+    out.number(head.read_4_bytes_little_endian());
+    out.put(R"(,"bits":)");
+    out.number(head.read_4_bytes_little_endian());
+    out.put(R"(,"nonce":)");
+    out.number(head.read_4_bytes_little_endian());
+    out.put('}');
+
+    auto first = true;
+    out.put(R"(,"transactions":[)");
+    for (const auto& tx: instance.views())
+    {
+        if (!first)
+            out.put(',');
+
+        emit(out, tx);
+        first = false;
+    }
+
+    out.put("]}");
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace
+
+// Sinks.
+// ----------------------------------------------------------------------------
+
+void to_json(writer& sink, const block& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const block_view& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const header& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const transaction& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const transaction_view& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const input& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const output& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const point& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const script& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+void to_json(writer& sink, const witness& instance) NOEXCEPT
+{
+    emitter out{ sink };
+    emit(out, instance);
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
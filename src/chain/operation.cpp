@@ -130,7 +130,7 @@ operation::operation(const chunk_cptr& push_data, bool minimal) NOEXCEPT
 }
 
 operation::operation(const data_slice& data) NOEXCEPT
-  : operation(stream::in::fast(data))
+  : operation(slice_reader(data))
 {
 }
 
@@ -161,6 +161,17 @@ operation::operation(reader& source) NOEXCEPT
 {
 }
 
+// protected
+operation::operation(slice_reader&& source) NOEXCEPT
+  : operation(source)
+{
+}
+
+operation::operation(slice_reader& source) NOEXCEPT
+  : operation(from_data(source))
+{
+}
+
 operation::operation(const std::string_view& mnemonic) NOEXCEPT
   : operation(from_string(mnemonic))
 {
@@ -192,7 +203,8 @@ bool operation::operator!=(const operation& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-operation operation::from_data(reader& source) NOEXCEPT
+template <typename Source>
+operation operation::from_data(Source& source) NOEXCEPT
 {
     // Guard against resetting a previously-invalid stream.
     if (!source)
@@ -216,8 +228,9 @@ operation operation::from_data(reader& source) NOEXCEPT
     if (size > max_bytes)
         source.invalidate();
 
-    // An invalid source.read_bytes_raw returns nullptr.
-    auto push = to_shared(source ? source.read_bytes(size) : data_chunk{});
+    // Push data is allocated by the source, and an invalid source returns
+    // nullptr. Non-push (or empty push) is not allocated (implies no_data).
+    auto push = is_zero(size) ? chunk_cptr{} : source.read_bytes_cptr(size);
     const auto underflow = !source;
 
     // This requires that provided stream terminates at the end of the script.
@@ -230,7 +243,7 @@ operation operation::from_data(reader& source) NOEXCEPT
     {
         code = any_invalid;
         source.set_position(start);
-        push = to_shared(source.read_bytes());
+        push = source.read_bytes_cptr();
     }
 
     // All byte vectors are deserializable, stream indicates own failure.
@@ -440,26 +453,6 @@ operation operation::from_string(const std::string_view& mnemonic) NOEXCEPT
     return { code, to_shared(std::move(chunk)), underflow };
 }
 
-static std::string opcode_to_prefix(opcode code,
-    const data_chunk& data) NOEXCEPT
-{
-    // If opcode is minimal for a size-based encoding, do not set a prefix.
-    if (code == operation::opcode_from_size(data.size()))
-        return "";
-
-    switch (code)
-    {
-        case opcode::push_one_size:
-            return "1.";
-        case opcode::push_two_size:
-            return "2.";
-        case opcode::push_four_size:
-            return "4.";
-        default:
-            return "0.";
-    }
-}
-
 std::string operation::to_string(uint32_t active_flags) const NOEXCEPT
 {
     if (!is_valid())
@@ -472,7 +465,7 @@ std::string operation::to_string(uint32_t active_flags) const NOEXCEPT
         return opcode_to_mnemonic(code_, active_flags);
 
     // Data encoding uses single token with explicit size prefix as required.
-    return "[" + opcode_to_prefix(code_, get_data()) +
+    return "[" + std::string{ opcode_to_prefix(code_, get_data().size()) } +
         encode_base16(get_data()) + "]";
 }
 
@@ -576,7 +569,8 @@ size_t operation::serialized_size() const NOEXCEPT
 // static/private
 // Advances stream, returns true unless exhausted.
 // Does not advance to end position in the case of underflow operation.
-bool operation::count_op(reader& source) NOEXCEPT
+template <typename Source>
+bool operation::skip_op(Source& source) NOEXCEPT
 {
     if (source.is_exhausted())
         return false;
@@ -587,7 +581,20 @@ bool operation::count_op(reader& source) NOEXCEPT
 }
 
 // static/private
-uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+bool operation::count_op(reader& source) NOEXCEPT
+{
+    return skip_op(source);
+}
+
+// static/private
+bool operation::count_op(slice_reader& source) NOEXCEPT
+{
+    return skip_op(source);
+}
+
+// static/private
+template <typename Source>
+uint32_t operation::read_data_size(opcode code, Source& source) NOEXCEPT
 {
     constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
 
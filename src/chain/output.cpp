@@ -68,7 +68,7 @@ output::output(uint64_t value, const chain::script::cptr& script) NOEXCEPT
 }
 
 output::output(const data_slice& data) NOEXCEPT
-  : output(stream::in::fast(data))
+  : output(slice_reader(data))
 {
 }
 
@@ -99,6 +99,17 @@ output::output(reader& source) NOEXCEPT
 {
 }
 
+// protected
+output::output(slice_reader&& source) NOEXCEPT
+  : output(source)
+{
+}
+
+output::output(slice_reader& source) NOEXCEPT
+  : output(from_data(source))
+{
+}
+
 // protected
 output::output(uint64_t value, const chain::script::cptr& script,
     bool valid) NOEXCEPT
@@ -127,12 +138,13 @@ bool output::operator!=(const output& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-output output::from_data(reader& source) NOEXCEPT
+template <typename Source>
+output output::from_data(Source& source) NOEXCEPT
 {
     return
     {
         source.read_8_bytes_little_endian(),
-        to_shared<chain::script>(source, true),
+        to_allocated<chain::script>(source.get_allocator(), source, true),
         source
     };
 }
@@ -51,7 +51,7 @@ point::point(const hash_digest& hash, uint32_t index) NOEXCEPT
 }
 
 point::point(const data_slice& data) NOEXCEPT
-  : point(stream::in::fast(data))
+  : point(slice_reader(data))
 {
 }
 
@@ -81,6 +81,17 @@ point::point(reader& source) NOEXCEPT
 {
 }
 
+// protected
+point::point(slice_reader&& source) NOEXCEPT
+  : point(source)
+{
+}
+
+point::point(slice_reader& source) NOEXCEPT
+  : point(from_data(source))
+{
+}
+
 // protected
 point::point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT
   : hash_(std::move(hash)), index_(index), valid_(valid)
@@ -137,7 +148,8 @@ bool operator!=(const point_cref& left, const point_cref& right) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-point point::from_data(reader& source) NOEXCEPT
+template <typename Source>
+point point::from_data(Source& source) NOEXCEPT
 {
     return
     {
@@ -150,12 +162,12 @@ point point::from_data(reader& source) NOEXCEPT
 // Serialization.
 // ----------------------------------------------------------------------------
 
+// Fixed size, so written directly to the chunk (non-virtual writer).
 data_chunk point::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
-    to_data(out);
+    write::bytes::slab out(data);
+    write_data(out);
     return data;
 }
 
@@ -166,6 +178,13 @@ void point::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void point::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void point::write_data(Sink& sink) const NOEXCEPT
 {
     sink.write_bytes(hash_);
     sink.write_4_bytes_little_endian(index_);
@@ -99,7 +99,7 @@ script::script(const operations& ops) NOEXCEPT
 }
     
 script::script(const data_slice& data, bool prefix) NOEXCEPT
-  : script(stream::in::fast(data), prefix)
+  : script(slice_reader(data), prefix)
 {
 }
 
@@ -130,11 +130,35 @@ script::script(reader& source, bool prefix) NOEXCEPT
 {
 }
 
+// protected
+script::script(slice_reader&& source, bool prefix) NOEXCEPT
+  : script(source, prefix)
+{
+}
+
+script::script(slice_reader& source, bool prefix) NOEXCEPT
+  : script(from_data(source, prefix))
+{
+}
+
 script::script(const std::string_view& mnemonic, bool bitcoind) NOEXCEPT
   : script(from_string(mnemonic, bitcoind))
 {
 }
 
+// protected
+script::script(operations&& ops, bool valid, bool easier, bool failer,
+    bool roller, size_t size) NOEXCEPT
+  : ops_(std::move(ops)),
+    valid_(valid),
+    easier_(easier),
+    failer_(failer),
+    roller_(roller),
+    size_(size),
+    offset(ops_.begin())
+{
+}
+
 // protected
 script::script(const operations& ops, bool valid, bool easier, bool failer,
     bool roller, size_t size) NOEXCEPT
@@ -190,7 +214,8 @@ bool script::operator!=(const script& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-size_t script::op_count(reader& source) NOEXCEPT
+template <typename Source>
+size_t script::op_count(Source& source) NOEXCEPT
 {
     // Stream errors reset by set_position so trap here.
     if (!source)
@@ -246,7 +271,8 @@ script script::from_operations(const operations& ops) NOEXCEPT
 }
 
 // static/private
-script script::from_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+script script::from_data(Source& source, bool prefix) NOEXCEPT
 {
     bool easier{};
     bool failer{};
@@ -260,7 +286,8 @@ script script::from_data(reader& source, bool prefix) NOEXCEPT
         source.set_limit(expected);
     }
 
-    operations ops{};
+    // Operations are allocated by the source (along with their push data).
+    operations ops{ source.get_allocator() };
     ops.reserve(op_count(source));
     const auto start = source.get_read_position();
 
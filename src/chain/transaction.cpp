@@ -19,7 +19,9 @@
 #include <bitcoin/system/chain/transaction.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <mutex>
 #include <numeric>
 #include <utility>
 #include <bitcoin/system/chain/batch/signatures.hpp>
@@ -77,7 +79,7 @@ transaction::transaction(uint32_t version, const inputs_cptr& inputs,
 }
 
 transaction::transaction(const data_slice& data, bool witness) NOEXCEPT
-  : transaction(stream::in::fast(data), witness)
+  : transaction(slice_reader(data), witness)
 {
 }
 
@@ -108,6 +110,17 @@ transaction::transaction(reader& source, bool witness) NOEXCEPT
 {
 }
 
+// protected
+transaction::transaction(slice_reader&& source, bool witness) NOEXCEPT
+  : transaction(source, witness)
+{
+}
+
+transaction::transaction(slice_reader& source, bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
 // protected
 transaction::transaction(uint32_t version, const chain::inputs_cptr& inputs,
     const chain::outputs_cptr& outputs, uint32_t locktime, bool segregated,
@@ -148,19 +161,22 @@ template<class Put, class Source>
 std::shared_ptr<const std_vector<std::shared_ptr<const Put>>>
 read_puts(Source& source) NOEXCEPT
 {
-    auto puts = to_shared<std_vector<std::shared_ptr<const Put>>>();
+    const auto& allocator = source.get_allocator();
+    auto puts = to_allocated<std_vector<std::shared_ptr<const Put>>>(allocator);
     const auto count = source.read_size(max_count);
+    const auto ptr = to_non_const_raw_ptr(puts);
 
-    puts->reserve(count);
+    ptr->reserve(count);
     for (auto put = zero; put < count; ++put)
-        puts->push_back(to_shared<Put>(source));
+        ptr->push_back(to_allocated<Put>(allocator, source));
 
     // This is a pointer copy (non-const to const).
     return puts;
 }
 
 // static/private
-transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+transaction transaction::from_data(Source& source, bool witness) NOEXCEPT
 {
     const auto version = source.read_4_bytes_little_endian();
 
@@ -955,7 +971,8 @@ code transaction::connect_input(const context& ctx, const input_iterator& it,
     }
 
     // Evaluate non-rolling scripts with constant search but linear erase.
-    return interpreter<contiguous_stack>::connect(ctx, *this, it, capture);
+    // Stack elements are bump allocated from the thread's stack arena.
+    return interpreter<arena_stack>::connect(ctx, *this, it, capture);
 }
 
 // Connect (contextual).
@@ -985,6 +1002,57 @@ code transaction::connect(const context& ctx,
     return error::transaction_success;
 }
 
+code transaction::connect_all(const context& ctx, uint32_t& index,
+    bool turbo) const NOEXCEPT
+{
+    if (is_coinbase())
+        return error::transaction_success;
+
+    // Signature hashes commit to all prevouts, so missing fails before fan-out.
+    for (uint32_t in = 0; in < inputs_->size(); ++in)
+    {
+        if (!inputs_->at(in)->prevout)
+        {
+            index = in;
+            return error::missing_previous_output;
+        }
+    }
+
+    // Signature hash caches are lazily set, which is not thread safe.
+    if (turbo && inputs_->size() > one)
+        set_signature_hashes();
+
+    const auto policy = poolstl::execution::par_if(turbo);
+    const signatures capture{};
+    std::vector<uint32_t> it(inputs_->size());
+    std::iota(it.begin(), it.end(), 0u);
+    code result{ error::transaction_success };
+    std::atomic<uint32_t> lowest{ max_uint32 };
+    std::mutex mutex{};
+
+    // Inputs below the lowest failure are always connected, so the reported
+    // failure is the first (deterministic). The lock is taken only on failure.
+    std::for_each(policy, it.cbegin(), it.cend(), [&](uint32_t at) NOEXCEPT
+    {
+        if (at > lowest.load(std::memory_order_relaxed))
+            return;
+
+        const auto in = std::next(inputs_->begin(), at);
+        if (const auto ec = connect_input(ctx, in, capture))
+        {
+            const std::unique_lock lock{ mutex };
+            if (at < lowest.load(std::memory_order_relaxed))
+            {
+                result = ec;
+                index = at;
+                lowest.store(at, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    return result;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
@@ -18,7 +18,9 @@
  */
 #include <bitcoin/system/chain/transaction.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/script.hpp>
@@ -26,6 +28,7 @@
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/script_cache.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -215,6 +218,81 @@ void transaction::set_v1_only_hash() const NOEXCEPT
         );
 }
 
+// Families are all, none or single (null sequences), and anyone_can_pay
+// (null points and sequences). Each prefix is version, points, sequences.
+void transaction::set_v0_midstates() const NOEXCEPT
+{
+    if (v0_midstates_)
+        return;
+
+    const auto prefix = [this](const hash_digest& points,
+        const hash_digest& sequences) NOEXCEPT
+    {
+        accumulator<sha256> context{};
+        context.write(to_little_endian(version_));
+        context.write(points);
+        context.write(sequences);
+        return context;
+    };
+
+    v0_midstates_ = std::make_shared<v0_midstates>(v0_midstates
+    {
+        prefix(double_hash_points(), double_hash_sequences()),
+        prefix(double_hash_points(), null_hash),
+        prefix(null_hash, null_hash)
+    });
+}
+
+// Families are the four (verified) sighash flags without anyone_can_pay, each
+// prefix is epoch, flags, version, locktime, four hashes and all's outputs.
+// The anyone_can_pay prefix is only ten bytes (plus outputs), so not cached.
+void transaction::set_v1_midstates() const NOEXCEPT
+{
+    if (v1_midstates_)
+        return;
+
+    const auto prefix = [this](uint8_t sighash_flags) NOEXCEPT
+    {
+        constexpr uint8_t epoch{};
+        auto context = hash::sha256t::fast<"TapSighash">::context();
+        context.write(one, &epoch);
+        context.write(one, &sighash_flags);
+        context.write(to_little_endian(version_));
+        context.write(to_little_endian(locktime_));
+        context.write(single_hash_points());
+        context.write(single_hash_amounts());
+        context.write(single_hash_scripts());
+        context.write(single_hash_sequences());
+
+        if (mask_sighash(sighash_flags) == coverage::hash_all)
+            context.write(single_hash_outputs());
+
+        return context;
+    };
+
+    v1_midstates_ = std::make_shared<v1_midstates>(v1_midstates
+    {
+        prefix(0x00), prefix(0x01), prefix(0x02), prefix(0x03)
+    });
+}
+
+// Witness signature hashing requires a segregated transaction. The version 1
+// cache requires all prevouts, so caller must first guard missing prevouts.
+void transaction::set_signature_hashes() const NOEXCEPT
+{
+    // The script cache is keyed on the witness hash.
+    if (machine::script_cache::enabled())
+        get_hash(true);
+
+    if (!segregated_)
+        return;
+
+    BC_ASSERT(!is_missing_prevouts());
+    set_x1_base_hash();
+    set_v0_midstates();
+    set_v1_midstates();
+}
+
 BC_POP_WARNING()
 
 // sha256x1 (script verson 1)
@@ -271,6 +349,29 @@ const hash_digest& transaction::double_hash_outputs() const NOEXCEPT
     return x2_base_cache_->outputs;
 }
 
+// midstates
+// ----------------------------------------------------------------------------
+
+const accumulator<sha256>& transaction::midstate_v0(
+    uint8_t sighash_flags) const NOEXCEPT
+{
+    set_v0_midstates();
+    if (is_anyone_can_pay(sighash_flags))
+        return v0_midstates_->at(2);
+
+    const auto all = (mask_sighash(sighash_flags) == coverage::hash_all);
+    return v0_midstates_->at(all ? 0 : 1);
+}
+
+// sighash_flags previously verified (see schnorr_split), not anyone_can_pay.
+const accumulator<sha256>& transaction::midstate_v1(
+    uint8_t sighash_flags) const NOEXCEPT
+{
+    BC_ASSERT(sighash_flags < std::tuple_size_v<v1_midstates>);
+    set_v1_midstates();
+    return v1_midstates_->at(sighash_flags);
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -64,17 +64,13 @@ void transaction::version0_sighash(hash_digest& out,
 {
     // Mask anyone_can_pay and unused bits, and set hash_all by default.
     const auto flag = mask_sighash(sighash_flags);
-    const auto anyone = is_anyone_can_pay(sighash_flags);
     const auto single = (flag == coverage::hash_single);
     const auto all = (flag == coverage::hash_all);
 
-    // Create hash writer.
+    // Create hash writer, continuing from the cached invariant prefix of
+    // version, points (unless anyone) and sequences (unless anyone or not all).
     stream::out::fast stream{ out };
-    hash::sha256x2::fast sink{ stream };
-
-    sink.write_4_bytes_little_endian(version_);
-    sink.write_bytes(!anyone ? double_hash_points() : null_hash);
-    sink.write_bytes(!anyone && all ? double_hash_sequences() : null_hash);
+    hash::sha256x2::fast sink{ stream, midstate_v0(sighash_flags) };
 
     (*input)->point().to_data(sink);
     subscript.to_data(sink, true);
@@ -93,26 +93,34 @@ bool transaction::version1_sighash(hash_digest& out,
     if (single && output_overflow(input_index(input)))
         return false;
 
+    // Invariant prefix is cached by defined (not anyone_can_pay) flag.
+    using tagged = hash::sha256t::fast<"TapSighash">;
+    const auto cached = !anyone && sighash_flags <= coverage::hash_single;
+
     // Create tagged hash writer.
     stream::out::fast stream{ out };
-    hash::sha256t::fast<"TapSighash"> sink{ stream };
-
-    sink.write_byte(epoch);
-    sink.write_byte(sighash_flags);
-    sink.write_4_bytes_little_endian(version_);
-    sink.write_4_bytes_little_endian(locktime_);
-
-    if (!anyone)
-    {
-        sink.write_bytes(single_hash_points());
-        sink.write_bytes(single_hash_amounts());
-        sink.write_bytes(single_hash_scripts());
-        sink.write_bytes(single_hash_sequences());
-    }
+    auto sink = cached ? tagged{ stream, midstate_v1(sighash_flags) } :
+        tagged{ stream };
 
-    if (all)
+    if (!cached)
     {
-        sink.write_bytes(single_hash_outputs());
+        sink.write_byte(epoch);
+        sink.write_byte(sighash_flags);
+        sink.write_4_bytes_little_endian(version_);
+        sink.write_4_bytes_little_endian(locktime_);
+
+        if (!anyone)
+        {
+            sink.write_bytes(single_hash_points());
+            sink.write_bytes(single_hash_amounts());
+            sink.write_bytes(single_hash_scripts());
+            sink.write_bytes(single_hash_sequences());
+        }
+
+        if (all)
+        {
+            sink.write_bytes(single_hash_outputs());
+        }
     }
 
     sink.write_byte(spend_type_v1(annex, !is_null(tapleaf)));
@@ -20,9 +20,11 @@
 
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 #include <bitcoin/system/chain/block.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/views/transaction_view.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -40,22 +42,53 @@ using namespace system;
 block_view::block_view(data_chunk&& block_buffer, bool witness) NOEXCEPT
   : witness_{ witness }, buffer_{ to_shared(std::move(block_buffer)) }
 {
-    stream::in::fast istream(*buffer_);
-    read::bytes::fast in(istream);
+    read::bytes::slice in(*buffer_);
     in.skip_bytes(header::serialized_size());
 
     const auto txs = in.read_size(max_count);
     if (is_zero(txs))
         return;
 
+    // Hashing is deferred to set_hashes().
     txs_.reserve(txs);
-    txs_.emplace_back(in, *buffer_, true, witness);
+    txs_.emplace_back(in, *buffer_, true, witness, false);
 
     for (auto tx = one; tx < txs; ++tx)
-        txs_.emplace_back(in, *buffer_, false, witness);
+        txs_.emplace_back(in, *buffer_, false, witness, false);
 
     if (!in)
+    {
         txs_.clear();
+        return;
+    }
+
+    set_hashes();
+}
+
+// private
+// Computes all txids and wtxids of the block as one set of messages, which
+// are double hashed concurrently across sha256 lanes (as available).
+void block_view::set_hashes() NOEXCEPT
+{
+    sha256::messages_t messages{};
+    messages.reserve(two * txs_.size());
+
+    for (const auto& tx: txs_)
+        messages.push_back(tx.nominal_message());
+
+    for (const auto& tx: txs_)
+        if (tx.has_witness_hash())
+            messages.push_back(tx.witness_message());
+
+    const auto digests = sha256::double_hash(messages);
+    auto digest = digests.begin();
+
+    for (auto& tx: txs_)
+        tx.txid_ = *digest++;
+
+    for (auto& tx: txs_)
+        if (tx.has_witness_hash())
+            tx.wtxid_ = *digest++;
 }
 
 // serialization
@@ -124,6 +157,15 @@ const transaction_views& block_view::views() const NOEXCEPT
     return txs_;
 }
 
+data_slice block_view::header_slice() const NOEXCEPT
+{
+    if (buffer_->size() < header::serialized_size())
+        return {};
+
+    const auto begin = buffer_->data();
+    return { begin, std::next(begin, header::serialized_size()) };
+}
+
 size_t block_view::serialized_size(bool witness) const NOEXCEPT
 {
     if (witness)
@@ -136,6 +178,28 @@ size_t block_view::serialized_size(bool witness) const NOEXCEPT
     return total;
 }
 
+size_t block_view::weight() const NOEXCEPT
+{
+    // Block weight is 3 * nominal size * + 1 * witness size [bip141].
+    return ceilinged_add(
+        ceilinged_multiply(base_size_contribution, serialized_size(false)),
+        ceilinged_multiply(total_size_contribution, serialized_size(witness_)));
+}
+
+size_t block_view::spends() const NOEXCEPT
+{
+    if (txs_.empty())
+        return zero;
+
+    // Overflow returns max_size_t.
+    const auto ins = [](size_t total, const auto& tx) NOEXCEPT
+    {
+        return ceilinged_add(total, tx.inputs());
+    };
+
+    return std::accumulate(std::next(txs_.begin()), txs_.end(), zero, ins);
+}
+
 code block_view::identify() const NOEXCEPT
 {
     if (txs_.empty())
@@ -157,6 +221,58 @@ code block_view::identify(const context& ctx) const NOEXCEPT
     return error::block_success;
 }
 
+// No chain::block or chain::transaction is materialized by check/accept.
+code block_view::check(bool identity) const NOEXCEPT
+{
+    // type64 malleated is a subset of first_not_coinbase.
+    // type32 malleated is a subset of is_internal_double_spend.
+    if (txs_.empty())
+        return error::empty_block;
+    if (is_oversized())
+        return error::block_size_limit;
+    if (is_first_non_coinbase())
+        return malleated_or(error::first_not_coinbase);
+    if (is_extra_coinbases())
+        return error::extra_coinbases;
+    if (is_forward_reference())
+        return error::forward_reference;
+    if (is_internal_double_spend())
+        return malleated_or(error::block_internal_double_spend);
+    if (identity && is_invalid_merkle_root())
+        return error::invalid_transaction_commitment;
+
+    return check_transactions();
+}
+
+// bip141 should be disabled when the node is not accepting witness data.
+code block_view::check(const context& ctx, bool identity) const NOEXCEPT
+{
+    const auto bip141 = ctx.is_enabled(bip141_rule);
+    const auto bip34 = ctx.is_enabled(bip34_rule);
+    const auto bip50 = ctx.is_enabled(bip50_rule);
+
+    if (bip141 && is_overweight())
+        return error::block_weight_limit;
+    if (bip34 && is_invalid_coinbase_script(ctx.height))
+        return error::coinbase_height_mismatch;
+    if (bip50 && is_hash_limit_exceeded())
+        return error::temporary_hash_limit;
+    if (bip141 && identity && is_invalid_witness_commitment())
+        return error::invalid_witness_commitment;
+
+    return check_transactions(ctx);
+}
+
+code block_view::accept(const context& ctx) const NOEXCEPT
+{
+    const auto bip141 = ctx.is_enabled(bip141_rule);
+
+    if (is_signature_operations_limited(bip141))
+        return error::block_sigop_limit;
+
+    return error::block_success;
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -186,6 +302,135 @@ bool block_view::is_invalid_witness_commitment() const NOEXCEPT
     return commit != sha256::double_hash(generate_merkle_root(true), reserve);
 }
 
+bool block_view::is_oversized() const NOEXCEPT
+{
+    return serialized_size(false) > max_block_size;
+}
+
+bool block_view::is_first_non_coinbase() const NOEXCEPT
+{
+    return !txs_.empty() && !txs_.front().is_coinbase_shaped();
+}
+
+bool block_view::is_extra_coinbases() const NOEXCEPT
+{
+    if (txs_.empty())
+        return false;
+
+    return std::any_of(std::next(txs_.begin()), txs_.end(),
+        [](const auto& tx) NOEXCEPT
+        {
+            return tx.is_coinbase_shaped();
+        });
+}
+
+// Point hashes are referenced in place within the block buffer.
+bool block_view::is_forward_reference() const NOEXCEPT
+{
+    if (txs_.empty())
+        return false;
+
+    flat_set_of_hash_cref hashes(sub1(txs_.size()));
+    for (auto tx = txs_.rbegin(); tx != std::prev(txs_.rend()); ++tx)
+    {
+        if (tx->is_spending(hashes))
+            return true;
+
+        hashes.emplace(tx->hash(false));
+    }
+
+    return false;
+}
+
+// Serialized points are referenced in place within the block buffer.
+bool block_view::is_internal_double_spend() const NOEXCEPT
+{
+    if (txs_.empty())
+        return false;
+
+    flat_set_of_point_bytes points(spends());
+    for (auto tx = std::next(txs_.begin()); tx != txs_.end(); ++tx)
+        if (!tx->put_points(points))
+            return true;
+
+    return false;
+}
+
+bool block_view::is_overweight() const NOEXCEPT
+{
+    return weight() > max_block_weight;
+}
+
+bool block_view::is_invalid_coinbase_script(size_t height) const NOEXCEPT
+{
+    if (txs_.empty())
+        return false;
+
+    return !txs_.front().is_coinbase_height(height);
+}
+
+bool block_view::is_hash_limit_exceeded() const NOEXCEPT
+{
+    if (txs_.empty())
+        return false;
+
+    // A set is used to collapse duplicates.
+    flat_set_of_hash_cref hashes(ceilinged_add(txs_.size(), spends()));
+
+    // Just the coinbase tx hash, skip its null input hashes.
+    hashes.emplace(txs_.front().hash(false));
+
+    for (auto tx = std::next(txs_.begin()); tx != txs_.end(); ++tx)
+    {
+        hashes.emplace(tx->hash(false));
+        tx->get_point_hashes(hashes);
+    }
+
+    return hashes.size() > hash_limit;
+}
+
+// Legacy sigops only, embedded and witness sigops require prevouts.
+bool block_view::is_signature_operations_limited(bool bip141) const NOEXCEPT
+{
+    const auto factor = bip141 ? heavy_sigops_factor : one;
+    const auto limit = bip141 ? max_fast_sigops : max_block_sigops;
+
+    size_t total{};
+    for (const auto& tx: txs_)
+        total = ceilinged_add(total,
+            ceilinged_multiply(tx.signature_operations(), factor));
+
+    return total > limit;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+code block_view::malleated_or(const code& ec) const NOEXCEPT
+{
+    return is_malleated() ? error::invalid_transaction_commitment : ec;
+}
+
+// DO invoke on coinbase.
+code block_view::check_transactions() const NOEXCEPT
+{
+    for (const auto& tx: txs_)
+        if (const auto ec = tx.check())
+            return ec;
+
+    return error::block_success;
+}
+
+// DO invoke on coinbase.
+code block_view::check_transactions(const context& ctx) const NOEXCEPT
+{
+    for (const auto& tx: txs_)
+        if (const auto ec = tx.check(ctx))
+            return ec;
+
+    return error::block_success;
+}
+
 // malleation
 // ----------------------------------------------------------------------------
 // private
@@ -0,0 +1,334 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/views/script_view.hpp>
+
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Underflow is represented as in operation.
+static constexpr auto any_invalid = opcode::op_verif;
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// const_iterator
+// ----------------------------------------------------------------------------
+
+script_view::const_iterator::const_iterator() NOEXCEPT
+  : position_{}, next_{}, end_{}, op_{}
+{
+}
+
+script_view::const_iterator::const_iterator(const uint8_t* begin,
+    const uint8_t* end) NOEXCEPT
+  : position_{ begin }, next_{ begin }, end_{ end }, op_{}
+{
+    decode();
+}
+
+script_view::const_iterator::reference
+script_view::const_iterator::operator*() const NOEXCEPT
+{
+    return op_;
+}
+
+script_view::const_iterator::pointer
+script_view::const_iterator::operator->() const NOEXCEPT
+{
+    return &op_;
+}
+
+script_view::const_iterator&
+script_view::const_iterator::operator++() NOEXCEPT
+{
+    position_ = next_;
+    decode();
+    return *this;
+}
+
+script_view::const_iterator
+script_view::const_iterator::operator++(int) NOEXCEPT
+{
+    auto copy = *this;
+    ++(*this);
+    return copy;
+}
+
+bool script_view::const_iterator::operator==(
+    const const_iterator& other) const NOEXCEPT
+{
+    return position_ == other.position_;
+}
+
+bool script_view::const_iterator::operator!=(
+    const const_iterator& other) const NOEXCEPT
+{
+    return !(*this == other);
+}
+
+// private
+// Same decoding as operation::from_data, in place and without allocation.
+void script_view::const_iterator::decode() NOEXCEPT
+{
+    if (position_ == end_)
+        return;
+
+    constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
+    const auto available = std::distance(position_, end_) - 1;
+    const auto code = static_cast<opcode>(*position_);
+    const auto data = std::next(position_);
+    ptrdiff_t prefix{};
+    size_t size{};
+
+    switch (code)
+    {
+        case opcode::push_one_size:
+            prefix = sizeof(uint8_t);
+            break;
+        case opcode::push_two_size:
+            prefix = sizeof(uint16_t);
+            break;
+        case opcode::push_four_size:
+            prefix = sizeof(uint32_t);
+            break;
+        default:
+            const auto byte = static_cast<uint8_t>(code);
+            size = byte <= op_75 ? byte : zero;
+            break;
+    }
+
+    if (prefix <= available)
+    {
+        switch (prefix)
+        {
+            case sizeof(uint8_t):
+                size = *data;
+                break;
+            case sizeof(uint16_t):
+                size = unsafe_from_little_endian<uint16_t>(data);
+                break;
+            case sizeof(uint32_t):
+                size = unsafe_from_little_endian<uint32_t>(data);
+                break;
+            default:
+                break;
+        }
+
+        const auto remaining = possible_narrow_sign_cast<size_t>(available -
+            prefix);
+
+        if (size <= max_bytes && size <= remaining)
+        {
+            const auto push = std::next(data, prefix);
+            next_ = std::next(push, size);
+            op_ = { code, { push, next_ }, false };
+            return;
+        }
+    }
+
+    // The underflow operation consumes the remainder of the script.
+    next_ = end_;
+    op_ = { any_invalid, { position_, end_ }, true };
+}
+
+// script_view
+// ----------------------------------------------------------------------------
+
+script_view::script_view() NOEXCEPT
+  : script_view(false, {})
+{
+}
+
+script_view::script_view(data_chunk&& data) NOEXCEPT
+  : script_view(true, std::move(data))
+{
+}
+
+script_view::script_view(const data_slice& data, bool prefix) NOEXCEPT
+  : script_view(stream::in::fast(data), prefix)
+{
+}
+
+// protected
+script_view::script_view(stream::in::fast&& stream, bool prefix) NOEXCEPT
+  : script_view(read::bytes::fast(stream), prefix)
+{
+}
+
+// protected
+script_view::script_view(reader&& source, bool prefix) NOEXCEPT
+  : script_view(source, prefix)
+{
+}
+
+script_view::script_view(reader& source, bool prefix) NOEXCEPT
+  : script_view(from_data(source, prefix))
+{
+}
+
+script_view::script_view(const script& script) NOEXCEPT
+  : script_view(script.is_valid(), script.to_data(false))
+{
+}
+
+// protected
+script_view::script_view(bool valid, data_chunk&& data) NOEXCEPT
+  : data_(std::move(data)), valid_(valid)
+{
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+bool script_view::operator==(const script_view& other) const NOEXCEPT
+{
+    return valid_ == other.valid_ && data_ == other.data_;
+}
+
+bool script_view::operator!=(const script_view& other) const NOEXCEPT
+{
+    return !(*this == other);
+}
+
+// Deserialization.
+// ----------------------------------------------------------------------------
+
+// static/private
+script_view script_view::from_data(reader& source, bool prefix) NOEXCEPT
+{
+    size_t expected{};
+    if (prefix)
+    {
+        // As script, `expected` is not allocated and limit does not change
+        // stream end.
+        expected = source.read_size();
+        source.set_limit(expected);
+    }
+
+    // Count bytes to the end (or limit), so allocation is bounded by data.
+    size_t size{};
+    while (!source.is_exhausted())
+    {
+        ++size;
+        source.skip_byte();
+    }
+
+    // Single allocation, by the source allocator.
+    source.rewind_bytes(size);
+    data_chunk data(size, source.get_allocator());
+    source.read_bytes(data.data(), size);
+
+    if (prefix)
+    {
+        source.set_limit();
+        if (size != expected)
+            source.invalidate();
+    }
+
+    return { source, std::move(data) };
+}
+
+// Serialization.
+// ----------------------------------------------------------------------------
+
+data_chunk script_view::to_data(bool prefix) const NOEXCEPT
+{
+    data_chunk data(serialized_size(prefix));
+    stream::out::fast ostream(data);
+    write::bytes::fast out(ostream);
+    to_data(out, prefix);
+    return data;
+}
+
+void script_view::to_data(writer& sink, bool prefix) const NOEXCEPT
+{
+    if (prefix)
+        sink.write_variable(data_.size());
+
+    sink.write_bytes(data_);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool script_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+// Only the last operation may be an underflow (linear).
+bool script_view::is_underflow() const NOEXCEPT
+{
+    auto underflow = false;
+    for (const auto& op: *this)
+        underflow = op.underflow;
+
+    return underflow;
+}
+
+const data_chunk& script_view::data() const NOEXCEPT
+{
+    return data_;
+}
+
+size_t script_view::serialized_size(bool prefix) const NOEXCEPT
+{
+    const auto size = data_.size();
+    return prefix ? ceilinged_add(variable_size(size), size) : size;
+}
+
+// Operations.
+// ----------------------------------------------------------------------------
+
+script_view::const_iterator script_view::begin() const NOEXCEPT
+{
+    return { data_.data(), std::next(data_.data(), data_.size()) };
+}
+
+script_view::const_iterator script_view::end() const NOEXCEPT
+{
+    const auto last = std::next(data_.data(), data_.size());
+    return { last, last };
+}
+
+size_t script_view::op_count() const NOEXCEPT
+{
+    return possible_narrow_sign_cast<size_t>(std::distance(begin(), end()));
+}
+
+script script_view::to_script() const NOEXCEPT
+{
+    return valid_ ? script{ data_, false } : script{};
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -18,13 +18,16 @@
  */
 #include <bitcoin/system/chain/views/transaction_view.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/machine.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -43,8 +46,25 @@ constexpr auto sentinels_size = sizeof(witness_marker) +
 // ----------------------------------------------------------------------------
 
 transaction_view::transaction_view(reader& source,
-    const data_chunk& block_buffer, bool coinbase, bool witness) NOEXCEPT
+    const data_chunk& block_buffer, bool coinbase, bool witness,
+    bool hashed) NOEXCEPT
   : coinbase_{ coinbase }
+{
+    parse(source, block_buffer, witness, hashed);
+}
+
+transaction_view::transaction_view(slice_reader& source,
+    const data_chunk& block_buffer, bool coinbase, bool witness,
+    bool hashed) NOEXCEPT
+  : coinbase_{ coinbase }
+{
+    parse(source, block_buffer, witness, hashed);
+}
+
+// private
+template <typename Source>
+void transaction_view::parse(Source& source, const data_chunk& block_buffer,
+    bool witness, bool hashed) NOEXCEPT
 {
     const auto tx_start = source.get_read_position();
     tx_ptr_ = std::next(block_buffer.data(), tx_start);
@@ -117,6 +137,9 @@ transaction_view::transaction_view(reader& source,
         return;
     }
 
+    if (!hashed)
+        return;
+
     // set hash identifiers
     if (has_witness)
     {
@@ -124,7 +147,7 @@ transaction_view::transaction_view(reader& source,
             stripped_size(), tx_ptr_);
 
         // non-witness and coinbase wtxid default to null_hash.
-        if (witness && !coinbase)
+        if (has_witness_hash())
             wtxid_ = bitcoin_hash(size_, tx_ptr_);
     }
     else
@@ -232,6 +255,294 @@ const hash_digest& transaction_view::hash(bool witness) const NOEXCEPT
     return witness && is_segregated() ? wtxid_ : txid_;
 }
 
+// public
+// ----------------------------------------------------------------------------
+// validation
+
+// Mirrors transaction::check(), coinbase is determined by shape not position.
+code transaction_view::check() const NOEXCEPT
+{
+    BC_ASSERT(is_valid());
+    const auto coinbase = is_coinbase_shaped();
+
+    if (is_zero(in_count_) || is_zero(out_count_))
+        return error::empty_transaction;
+    if (coinbase && is_invalid_coinbase_size())
+        return error::invalid_coinbase_script_size;
+    if (!coinbase && is_null_non_coinbase())
+        return error::previous_output_null;
+
+    return error::transaction_success;
+}
+
+// Mirrors transaction::check(context).
+code transaction_view::check(const context& ctx) const NOEXCEPT
+{
+    BC_ASSERT(is_valid());
+    const auto bip113 = ctx.is_enabled(bip113_rule);
+
+    if (is_absolute_locked(ctx.height, ctx.timestamp, ctx.median_time_past,
+        bip113))
+        return error::absolute_time_locked;
+
+    return error::transaction_success;
+}
+
+// public
+// ----------------------------------------------------------------------------
+// validation helpers
+
+// Same as transaction::is_coinbase(), one input with a null point.
+bool transaction_view::is_coinbase_shaped() const NOEXCEPT
+{
+    return is_one(in_count_) && is_null_point();
+}
+
+// Same as script::is_coinbase_pattern() over the first input script [bip34].
+// A nominal push of a height (at most five bytes) is its size opcode.
+bool transaction_view::is_coinbase_height(size_t height) const NOEXCEPT
+{
+    using namespace machine::number;
+    const auto expected = chunk::from_integer(to_signed(height));
+    const auto inputs = at_inputs();
+    read::bytes::slice source(at_inputs(), inputs_size());
+    source.skip_bytes(point_size);
+
+    const auto size = source.read_size();
+    const auto script = std::next(inputs, source.get_read_position());
+    const auto push = expected.size();
+    if (!source || size <= push || *script != push)
+        return false;
+
+    const auto data = std::next(script);
+    return std::equal(expected.begin(), expected.end(), data);
+}
+
+// True if any input point hash is in the set.
+bool transaction_view::is_spending(
+    const flat_set_of_hash_cref& hashes) const NOEXCEPT
+{
+    const auto inputs = at_inputs();
+    read::bytes::slice source(at_inputs(), inputs_size());
+
+    for (size_t input{}; input < in_count_; ++input)
+    {
+        const auto point = std::next(inputs, source.get_read_position());
+        if (hashes.contains(unsafe_array_cast<uint8_t, hash_size>(point)))
+            return true;
+
+        source.skip_bytes(point_size);
+        source.skip_bytes(source.read_size() + sequence_size);
+    }
+
+    return false;
+}
+
+// Hash references are into the block buffer.
+void transaction_view::get_point_hashes(
+    flat_set_of_hash_cref& out) const NOEXCEPT
+{
+    const auto inputs = at_inputs();
+    read::bytes::slice source(at_inputs(), inputs_size());
+
+    for (size_t input{}; input < in_count_; ++input)
+    {
+        const auto point = std::next(inputs, source.get_read_position());
+        out.emplace(unsafe_array_cast<uint8_t, hash_size>(point));
+        source.skip_bytes(point_size);
+        source.skip_bytes(source.read_size() + sequence_size);
+    }
+}
+
+// Point references are into the block buffer, false if any already in set.
+bool transaction_view::put_points(
+    flat_set_of_point_bytes& out) const NOEXCEPT
+{
+    const auto inputs = at_inputs();
+    read::bytes::slice source(at_inputs(), inputs_size());
+
+    for (size_t input{}; input < in_count_; ++input)
+    {
+        const auto point = std::next(inputs, source.get_read_position());
+        if (!out.emplace(unsafe_array_cast<uint8_t, point_size>(point)))
+            return false;
+
+        source.skip_bytes(point_size);
+        source.skip_bytes(source.read_size() + sequence_size);
+    }
+
+    return true;
+}
+
+// Legacy (inaccurate) sigops of input and output scripts, unweighted.
+// This is the prevout-independent component of transaction sigops.
+size_t transaction_view::signature_operations() const NOEXCEPT
+{
+    size_t total{};
+    const auto inputs = at_inputs();
+    read::bytes::slice source(at_inputs(), inputs_size());
+
+    for (size_t input{}; input < in_count_; ++input)
+    {
+        source.skip_bytes(point_size);
+        const auto size = source.read_size();
+        const auto script = std::next(inputs, source.get_read_position());
+        total = ceilinged_add(total, script_signature_operations(script, size));
+        source.skip_bytes(size + sequence_size);
+    }
+
+    // Outputs immediately follow inputs in the inputs stream.
+    source.skip_variable();
+    for (size_t output{}; output < out_count_; ++output)
+    {
+        source.skip_bytes(value_size);
+        const auto size = source.read_size();
+        const auto script = std::next(inputs, source.get_read_position());
+        total = ceilinged_add(total, script_signature_operations(script, size));
+        source.skip_bytes(size);
+    }
+
+    return total;
+}
+
+// private
+// ----------------------------------------------------------------------------
+// hash messages
+
+// Non-witness and coinbase wtxid default to null_hash.
+bool transaction_view::has_witness_hash() const NOEXCEPT
+{
+    return segregated_ && !coinbase_;
+}
+
+// Same slices as transaction::desegregated_hash when witnessed.
+sha256::message_t transaction_view::nominal_message() const NOEXCEPT
+{
+    BC_ASSERT(is_valid());
+
+    if (is_zero(witnesses_size_))
+        return { data_slice{ tx_ptr_, std::next(tx_ptr_, size_) } };
+
+    const auto body = std::next(tx_ptr_, version_size + sentinels_size);
+    const auto puts = stripped_size() - (version_size + locktime_size);
+    const auto locktime = std::next(tx_ptr_, size_ - locktime_size);
+
+    return
+    {
+        data_slice{ tx_ptr_, std::next(tx_ptr_, version_size) },
+        data_slice{ body, std::next(body, puts) },
+        data_slice{ locktime, std::next(locktime, locktime_size) }
+    };
+}
+
+sha256::message_t transaction_view::witness_message() const NOEXCEPT
+{
+    BC_ASSERT(is_valid());
+    return { data_slice{ tx_ptr_, std::next(tx_ptr_, size_) } };
+}
+
+// private
+// ----------------------------------------------------------------------------
+// check helpers
+
+bool transaction_view::is_null_non_coinbase() const NOEXCEPT
+{
+    const auto inputs = at_inputs();
+    read::bytes::slice source(at_inputs(), inputs_size());
+
+    for (size_t input{}; input < in_count_; ++input)
+    {
+        const auto point = std::next(inputs, source.get_read_position());
+        const auto index = std::next(point, hash_size);
+        if (unsafe_array_cast<uint8_t, hash_size>(point) == null_hash &&
+            unsafe_from_little_endian<uint32_t>(index) ==
+                chain::point::null_index)
+            return true;
+
+        source.skip_bytes(point_size);
+        source.skip_bytes(source.read_size() + sequence_size);
+    }
+
+    return false;
+}
+
+bool transaction_view::is_invalid_coinbase_size() const NOEXCEPT
+{
+    read::bytes::slice source(at_inputs(), inputs_size());
+    source.skip_bytes(point_size);
+    const auto script_size = source.read_size();
+    return script_size < min_coinbase_size || script_size > max_coinbase_size;
+}
+
+bool transaction_view::is_absolute_locked(size_t height, uint32_t timestamp,
+    uint32_t median_time_past, bool bip113) const NOEXCEPT
+{
+    // BIP113: comparing the locktime against the median of the past 11 block
+    // timestamps, rather than the timestamp of the block including the tx.
+    const auto time = bip113 ? median_time_past : timestamp;
+    const auto lock = locktime();
+    const auto height_time = lock < locktime_threshold ? height : time;
+
+    if (is_zero(lock) || lock < height_time)
+        return false;
+
+    read::bytes::slice source(at_inputs(), inputs_size());
+
+    // Locked unless all inputs are final.
+    for (size_t input{}; input < in_count_; ++input)
+    {
+        source.skip_bytes(point_size);
+        source.skip_bytes(source.read_size());
+        if (source.read_4_bytes_little_endian() != max_input_sequence)
+            return true;
+    }
+
+    return false;
+}
+
+// static
+// Mirrors script::signature_operations(false) without parsing operations.
+// An underflow (undersized push) can only be last and is not a sigop.
+size_t transaction_view::script_signature_operations(const uint8_t* script,
+    size_t size) NOEXCEPT
+{
+    constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
+    read::bytes::slice source(script, size);
+    size_t total{};
+
+    while (!source.is_exhausted())
+    {
+        const auto code = static_cast<opcode>(source.read_byte());
+
+        switch (code)
+        {
+            case opcode::checksig:
+            case opcode::checksigverify:
+                total = ceilinged_add(total, one);
+                break;
+            case opcode::checkmultisig:
+            case opcode::checkmultisigverify:
+                total = ceilinged_add(total, multisig_default_sigops);
+                break;
+            case opcode::push_one_size:
+                source.skip_bytes(source.read_byte());
+                break;
+            case opcode::push_two_size:
+                source.skip_bytes(source.read_2_bytes_little_endian());
+                break;
+            case opcode::push_four_size:
+                source.skip_bytes(source.read_4_bytes_little_endian());
+                break;
+            default:
+                const auto byte = static_cast<uint8_t>(code);
+                source.skip_bytes(byte <= op_75 ? byte : zero);
+                break;
+        }
+    }
+
+    return total;
+}
+
 // public
 // ----------------------------------------------------------------------------
 // store helpers
@@ -256,8 +567,7 @@ bool transaction_view::get_witness_commitment(
     hash_cref& commitment) const NOEXCEPT
 {
     const auto output = at_outputs();
-    stream::in::fast istream(output, outputs_size());
-    read::bytes::fast reader(istream);
+    read::bytes::slice reader(output, outputs_size());
     bool found{};
 
     for (size_t out{}; out < out_count_; ++out)
@@ -370,6 +680,23 @@ stream::in::fast transaction_view::get_witnesses_stream() const NOEXCEPT
     return { at_witnesses(), limit };
 }
 
+// slices
+
+data_slice transaction_view::get_inputs_slice() const NOEXCEPT
+{
+    return { at_inputs(), std::next(at_inputs(), inputs_size()) };
+}
+
+data_slice transaction_view::get_outputs_slice() const NOEXCEPT
+{
+    return { at_outputs(), std::next(at_outputs(), outputs_size()) };
+}
+
+data_slice transaction_view::get_witnesses_slice() const NOEXCEPT
+{
+    return { at_witnesses(), std::next(at_witnesses(), witnesses_size()) };
+}
+
 // private/static
 // ----------------------------------------------------------------------------
 // witness commitment
@@ -63,7 +63,7 @@ witness::witness(const chunk_cptrs& stack) NOEXCEPT
 }
 
 witness::witness(const data_slice& data, bool prefix) NOEXCEPT
-  : witness(stream::in::fast(data), prefix)
+  : witness(slice_reader(data), prefix)
 {
 }
 
@@ -94,6 +94,17 @@ witness::witness(reader& source, bool prefix) NOEXCEPT
 {
 }
 
+// protected
+witness::witness(slice_reader&& source, bool prefix) NOEXCEPT
+  : witness(source, prefix)
+{
+}
+
+witness::witness(slice_reader& source, bool prefix) NOEXCEPT
+  : witness(from_data(source, prefix))
+{
+}
+
 witness::witness(const std::string_view& mnemonic) NOEXCEPT
   : witness(from_string(mnemonic))
 {
@@ -117,6 +128,15 @@ witness::witness(const chunk_cptrs& stack, bool valid) NOEXCEPT
 {
 }
 
+// protected
+witness::witness(chunk_cptrs&& stack, bool valid, size_t size) NOEXCEPT
+  : stack_(std::move(stack)),
+    valid_(valid),
+    size_(size),
+    annex_(annex::is_annex_pattern(stack_) ? stack_.back() : nullptr)
+{
+}
+
 // protected
 witness::witness(const chunk_cptrs& stack, bool valid, size_t size) NOEXCEPT
   : stack_(stack),
@@ -149,17 +169,23 @@ static inline size_t element_size(const chunk_cptr& element) NOEXCEPT
     return ceilinged_add(variable_size(size), size);
 };
 
-static inline data_chunk read_element(reader& source) NOEXCEPT
+template <typename Source>
+static inline chunk_cptr read_element(Source& source) NOEXCEPT
 {
     // Each witness encoded as variable integer prefixed byte array (bip144).
-    return source.read_bytes(source.read_size(max_bytes));
+    // Elements are allocated by the source, and an invalid source returns
+    // nullptr, which is replaced with an empty element (stream is invalid).
+    const auto element = source.read_bytes_cptr(source.read_size(max_bytes));
+    return element ? element :
+        to_allocated<data_chunk>(source.get_allocator());
 }
 
 // static/private
-witness witness::from_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+witness witness::from_data(Source& source, bool prefix) NOEXCEPT
 {
     size_t size{};
-    chunk_cptrs stack{};
+    chunk_cptrs stack{ source.get_allocator() };
 
     if (prefix)
     {
@@ -169,7 +195,7 @@ witness witness::from_data(reader& source, bool prefix) NOEXCEPT
 
         for (size_t element{}; element < count; ++element)
         {
-            stack.push_back(to_shared<data_chunk>(read_element(source)));
+            stack.push_back(read_element(source));
             size += element_size(stack.back());
         }
     }
@@ -177,16 +203,16 @@ witness witness::from_data(reader& source, bool prefix) NOEXCEPT
     {
         while (!source.is_exhausted())
         {
-            stack.push_back(to_shared<data_chunk>(read_element(source)));
+            stack.push_back(read_element(source));
             size += element_size(stack.back());
         }
     }
 
-    return { stack, source, size };
+    return { std::move(stack), source, size };
 }
 
-// static
-bool witness::skip(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+static bool skip_witness(Source& source, bool prefix) NOEXCEPT
 {
     bool superfluous{ true };
     if (prefix)
@@ -196,7 +222,7 @@ bool witness::skip(reader& source, bool prefix) NOEXCEPT
         for (size_t element{}; element < count; ++element)
         {
             const auto size = source.read_size(max_bytes);
-            source.read_bytes(size);
+            source.skip_bytes(size);
             if (!is_zero(size))
                 superfluous = false;
         }
@@ -206,7 +232,7 @@ bool witness::skip(reader& source, bool prefix) NOEXCEPT
         while (!source.is_exhausted())
         {
             const auto size = source.read_size(max_bytes);
-            source.read_bytes(size);
+            source.skip_bytes(size);
             if (!is_zero(size))
                 superfluous = false;
         }
@@ -215,6 +241,18 @@ bool witness::skip(reader& source, bool prefix) NOEXCEPT
     return !superfluous;
 }
 
+// static
+bool witness::skip(reader& source, bool prefix) NOEXCEPT
+{
+    return skip_witness(source, prefix);
+}
+
+// static
+bool witness::skip(slice_reader& source, bool prefix) NOEXCEPT
+{
+    return skip_witness(source, prefix);
+}
+
 // Serialization.
 // ----------------------------------------------------------------------------
 
@@ -20,6 +20,7 @@
 
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -326,6 +327,154 @@ constexpr void expand_key_inverse(aes256::secret& key, uint8_t& round) NOEXCEPT
     key[3] ^= sbox[key[28]];
 }
 
+// AES-NI (xcpu)
+// ----------------------------------------------------------------------------
+// Compiled only with enable-aesni (HAVE_AESNI), otherwise the stubs in
+// intrinsics/none are never invoked. The cpu is also tested at runtime so that
+// a binary built with -maes falls back to the byte-oriented implementation.
+// Four independent blocks are interleaved to cover the aesenc/aesdec latency.
+
+constexpr size_t lanes = 4;
+using round_keys = std_array<xint128_t, add1(rounds)>;
+
+static bool aesni() NOEXCEPT
+{
+    if constexpr (have_aes)
+    {
+        static const auto enabled = try_aesni();
+        return enabled;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+static void encrypt_keys(round_keys& keys, const aes256::secret& key) NOEXCEPT
+{
+    const auto& words = array_cast<xint128_t>(key);
+    keys[0] = aes::load(words[0]);
+    keys[1] = aes::load(words[1]);
+    keys[2] = aes::expand_even<0x01>(keys[0], keys[1]);
+    keys[3] = aes::expand_odd(keys[1], keys[2]);
+    keys[4] = aes::expand_even<0x02>(keys[2], keys[3]);
+    keys[5] = aes::expand_odd(keys[3], keys[4]);
+    keys[6] = aes::expand_even<0x04>(keys[4], keys[5]);
+    keys[7] = aes::expand_odd(keys[5], keys[6]);
+    keys[8] = aes::expand_even<0x08>(keys[6], keys[7]);
+    keys[9] = aes::expand_odd(keys[7], keys[8]);
+    keys[10] = aes::expand_even<0x10>(keys[8], keys[9]);
+    keys[11] = aes::expand_odd(keys[9], keys[10]);
+    keys[12] = aes::expand_even<0x20>(keys[10], keys[11]);
+    keys[13] = aes::expand_odd(keys[11], keys[12]);
+    keys[14] = aes::expand_even<0x40>(keys[12], keys[13]);
+}
+
+static void decrypt_keys(round_keys& keys, const aes256::secret& key) NOEXCEPT
+{
+    // Equivalent inverse cipher reverses and inverse mixes the inner keys.
+    round_keys forward{};
+    encrypt_keys(forward, key);
+    keys.front() = forward.back();
+    keys.back() = forward.front();
+    for (size_t round = 1; round < rounds; ++round)
+        keys[round] = aes::inverse_mix(forward[rounds - round]);
+}
+
+template <size_t Lanes>
+static void encrypt_lanes(aes256::block* bytes, const round_keys& keys) NOEXCEPT
+{
+    std_array<xint128_t, Lanes> state{};
+    for (size_t lane{}; lane < Lanes; ++lane)
+        state[lane] = aes::add_key(aes::load(
+            array_cast<xint128_t>(bytes[lane]).front()), keys.front());
+
+    for (size_t round = 1; round < rounds; ++round)
+        for (size_t lane{}; lane < Lanes; ++lane)
+            state[lane] = aes::encrypt(state[lane], keys[round]);
+
+    for (size_t lane{}; lane < Lanes; ++lane)
+        aes::store(array_cast<xint128_t>(bytes[lane]).front(),
+            aes::encrypt_last(state[lane], keys.back()));
+}
+
+template <size_t Lanes>
+static void decrypt_lanes(aes256::block* bytes, const round_keys& keys) NOEXCEPT
+{
+    std_array<xint128_t, Lanes> state{};
+    for (size_t lane{}; lane < Lanes; ++lane)
+        state[lane] = aes::add_key(aes::load(
+            array_cast<xint128_t>(bytes[lane]).front()), keys.front());
+
+    for (size_t round = 1; round < rounds; ++round)
+        for (size_t lane{}; lane < Lanes; ++lane)
+            state[lane] = aes::decrypt(state[lane], keys[round]);
+
+    for (size_t lane{}; lane < Lanes; ++lane)
+        aes::store(array_cast<xint128_t>(bytes[lane]).front(),
+            aes::decrypt_last(state[lane], keys.back()));
+}
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+static void encrypt_blocks(aes256::blocks& bytes, const round_keys& keys) NOEXCEPT
+{
+    const auto count = bytes.size();
+    const auto whole = count - (count % lanes);
+    const auto data = bytes.data();
+
+    for (size_t index{}; index < whole; index += lanes)
+        encrypt_lanes<lanes>(data + index, keys);
+
+    for (auto index = whole; index < count; ++index)
+        encrypt_lanes<one>(data + index, keys);
+}
+
+static void decrypt_blocks(aes256::blocks& bytes, const round_keys& keys) NOEXCEPT
+{
+    const auto count = bytes.size();
+    const auto whole = count - (count % lanes);
+    const auto data = bytes.data();
+
+    for (size_t index{}; index < whole; index += lanes)
+        decrypt_lanes<lanes>(data + index, keys);
+
+    for (auto index = whole; index < count; ++index)
+        decrypt_lanes<one>(data + index, keys);
+}
+
+BC_POP_WARNING()
+
+// Counter mode.
+// ----------------------------------------------------------------------------
+
+constexpr void increment(aes256::block& counter) NOEXCEPT
+{
+    // Big-endian 128 bit increment, wraps at 2^128.
+    for (auto byte = counter.rbegin(); byte != counter.rend(); ++byte)
+        if (!is_zero(++(*byte)))
+            return;
+}
+
+static aes256::blocks keystream(size_t size, const aes256::block& counter) NOEXCEPT
+{
+    aes256::blocks out(ceilinged_divide(size, block_size));
+    auto next = counter;
+    for (auto& block: out)
+    {
+        block = next;
+        increment(next);
+    }
+
+    return out;
+}
+
+static void xor_stream(data_chunk& bytes, const aes256::blocks& stream) NOEXCEPT
+{
+    for (size_t index{}; index < bytes.size(); ++index)
+        bytes[index] ^= stream[index / block_size][index % block_size];
+}
+
 // private/static
 // ----------------------------------------------------------------------------
 
@@ -399,6 +548,14 @@ void aes256::decrypt_ecb(context& context, block& bytes) NOEXCEPT
 
 void aes256::encrypt_ecb(block& bytes, const secret& key) NOEXCEPT
 {
+    if (aesni())
+    {
+        round_keys keys{};
+        encrypt_keys(keys, key);
+        encrypt_lanes<one>(&bytes, keys);
+        return;
+    }
+
     context context{};
     initialize(context, key);
     encrypt_ecb(context, bytes);
@@ -406,11 +563,66 @@ void aes256::encrypt_ecb(block& bytes, const secret& key) NOEXCEPT
 
 void aes256::decrypt_ecb(block& bytes, const secret& key) NOEXCEPT
 {
+    if (aesni())
+    {
+        round_keys keys{};
+        decrypt_keys(keys, key);
+        decrypt_lanes<one>(&bytes, keys);
+        return;
+    }
+
     context context;
     initialize(context, key);
     decrypt_ecb(context, bytes);
 }
 
+void aes256::encrypt_ecb(blocks& bytes, const secret& key) NOEXCEPT
+{
+    if (aesni())
+    {
+        round_keys keys{};
+        encrypt_keys(keys, key);
+        encrypt_blocks(bytes, keys);
+        return;
+    }
+
+    context context{};
+    initialize(context, key);
+    for (auto& block: bytes)
+        encrypt_ecb(context, block);
+}
+
+void aes256::decrypt_ecb(blocks& bytes, const secret& key) NOEXCEPT
+{
+    if (aesni())
+    {
+        round_keys keys{};
+        decrypt_keys(keys, key);
+        decrypt_blocks(bytes, keys);
+        return;
+    }
+
+    context context{};
+    initialize(context, key);
+    for (auto& block: bytes)
+        decrypt_ecb(context, block);
+}
+
+void aes256::encrypt_ctr(data_chunk& bytes, const block& counter,
+    const secret& key) NOEXCEPT
+{
+    auto stream = keystream(bytes.size(), counter);
+    encrypt_ecb(stream, key);
+    xor_stream(bytes, stream);
+}
+
+void aes256::decrypt_ctr(data_chunk& bytes, const block& counter,
+    const secret& key) NOEXCEPT
+{
+    // Counter mode is symmetric.
+    encrypt_ctr(bytes, counter, key);
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
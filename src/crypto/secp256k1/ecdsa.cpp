@@ -25,6 +25,7 @@
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include "ec_context.hpp"
+#include "key_cache.hpp"
 #include "serialize.hpp"
 
 namespace libbitcoin {
@@ -174,7 +175,7 @@ bool verify_signature(const ec_compressed& compressed,
     const auto context = ec_context_verify::context();
 
     secp256k1_pubkey pubkey;
-    return ec_public_key_parse(context, pubkey, compressed) &&
+    return parse_cached(context, pubkey, compressed) &&
         verify_signature(context, pubkey, hash, signature);
 }
 
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "key_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <secp256k1.h>
+#include <secp256k1_schnorrsig.h>
+#include <bitcoin/system/crypto/pseudo_random.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include "serialize.hpp"
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+static constexpr auto ec_success = 1;
+static constexpr auto relaxed = std::memory_order_relaxed;
+static constexpr auto acquire = std::memory_order_acquire;
+static constexpr auto release = std::memory_order_release;
+
+// Set-associative table of parsed keys, keyed by serialized point, over
+// sequence locked slots (as digest_set). Replacement within a set is CLOCK
+// (second chance), which approximates LRU without reader writes beyond the
+// reference bit. Sets are selected by salted siphash, so ground keys cannot
+// target hot sets.
+template <size_t Size, typename Parsed>
+class parsed_keys
+{
+public:
+    using key = data_array<Size>;
+
+    parsed_keys(size_t entries) NOEXCEPT
+      : mask_(sub1(std::bit_ceil(std::max(one,
+            ceilinged_divide(entries, ways))))),
+        salt_{ pseudo_random::next<uint64_t>(),
+            pseudo_random::next<uint64_t>() },
+        slots_(add1(mask_) * ways)
+    {
+    }
+
+    bool get(Parsed& out, const key& point) NOEXCEPT
+    {
+        const auto set = to_set(point);
+        const auto expected = to_words(point, {});
+        auto& counter = counters_[set % shards];
+
+        words stored{};
+        for (size_t way{}; way < ways; ++way)
+        {
+            auto& slot = slots_[set * ways + way];
+            if (!slot.lock.read(stored) || !std::equal(stored.begin(),
+                std::next(stored.begin(), key_words), expected.begin()))
+                continue;
+
+            if (!slot.referenced.load(relaxed))
+                slot.referenced.store(true, relaxed);
+
+            std::memcpy(&out, &stored[key_words], sizeof(Parsed));
+            counter.hits.fetch_add(one, relaxed);
+            return true;
+        }
+
+        counter.misses.fetch_add(one, relaxed);
+        return false;
+    }
+
+    void put(const key& point, const Parsed& parsed) NOEXCEPT
+    {
+        const auto set = to_set(point);
+        auto& slot = slots_[set * ways + to_victim(set)];
+        if (slot.lock.write(to_words(point, parsed)))
+            slot.referenced.store(false, relaxed);
+    }
+
+    digest_set::statistics statistics() const NOEXCEPT
+    {
+        digest_set::statistics out{};
+        for (const auto& counter: counters_)
+        {
+            out.hits += counter.hits.load(relaxed);
+            out.misses += counter.misses.load(relaxed);
+        }
+
+        out.capacity = slots_.size();
+        return out;
+    }
+
+private:
+    static constexpr size_t ways = 4;
+    static constexpr size_t shards = 16;
+    static constexpr size_t word_size = sizeof(uint64_t);
+    static constexpr size_t key_words = ceilinged_divide(Size, word_size);
+    static constexpr size_t value_words = sizeof(Parsed) / word_size;
+    static_assert(is_zero(sizeof(Parsed) % word_size));
+
+    using words = std::array<uint64_t, key_words + value_words>;
+
+    struct slot
+    {
+        sequence_slot<key_words + value_words> lock{};
+        std::atomic_bool referenced{};
+    };
+
+    // Counters are sharded by set to avoid a contended cache line.
+    struct alignas(64) counter
+    {
+        std::atomic<uint64_t> hits{};
+        std::atomic<uint64_t> misses{};
+    };
+
+    // Key words (zero padded) followed by value words.
+    static words to_words(const key& point, const Parsed& parsed) NOEXCEPT
+    {
+        words out{};
+        std::memcpy(out.data(), point.data(), Size);
+        std::memcpy(&out[key_words], &parsed, sizeof(Parsed));
+        return out;
+    }
+
+    size_t to_set(const key& point) const NOEXCEPT
+    {
+        return possible_narrow_cast<size_t>(siphash(salt_, point)) & mask_;
+    }
+
+    // Prefer an unused slot, then the first unreferenced slot (clearing the
+    // reference of each passed slot), then the first slot.
+    size_t to_victim(size_t set) NOEXCEPT
+    {
+        for (size_t way{}; way < ways; ++way)
+            if (slots_[set * ways + way].lock.empty())
+                return way;
+
+        for (size_t way{}; way < ways; ++way)
+            if (!slots_[set * ways + way].referenced.exchange(false, relaxed))
+                return way;
+
+        return zero;
+    }
+
+    const size_t mask_;
+    const siphash_key salt_;
+    std::vector<slot> slots_;
+    std::array<counter, shards> counters_{};
+};
+
+using compressed_keys = parsed_keys<ec_compressed_size, secp256k1_pubkey>;
+using xonly_keys = parsed_keys<ec_xonly_size, secp256k1_xonly_pubkey>;
+
+struct caches
+{
+    std::unique_ptr<compressed_keys> compressed{};
+    std::unique_ptr<xonly_keys> xonly{};
+    std::atomic_bool enabled{};
+};
+
+static caches& get_caches() NOEXCEPT
+{
+    static caches instance{};
+    return instance;
+}
+
+// Parse
+// ----------------------------------------------------------------------------
+
+bool parse_cached(const secp256k1_context* context, secp256k1_pubkey& out,
+    const ec_compressed& point) NOEXCEPT
+{
+    auto& caches = get_caches();
+    if (!caches.enabled.load(acquire))
+        return ec_public_key_parse(context, out, point);
+
+    if (caches.compressed->get(out, point))
+        return true;
+
+    if (!ec_public_key_parse(context, out, point))
+        return false;
+
+    caches.compressed->put(point, out);
+    return true;
+}
+
+bool parse_cached(const secp256k1_context* context,
+    secp256k1_xonly_pubkey& out, const ec_xonly& point) NOEXCEPT
+{
+    auto& caches = get_caches();
+    if (!caches.enabled.load(acquire))
+        return secp256k1_xonly_pubkey_parse(context, &out, point.data()) ==
+            ec_success;
+
+    if (caches.xonly->get(out, point))
+        return true;
+
+    if (secp256k1_xonly_pubkey_parse(context, &out, point.data()) !=
+        ec_success)
+        return false;
+
+    caches.xonly->put(point, out);
+    return true;
+}
+
+// Configuration
+// ----------------------------------------------------------------------------
+
+namespace key_cache {
+
+void enable(size_t entries) NOEXCEPT
+{
+    disable();
+    if (is_zero(entries))
+        return;
+
+    auto& caches = get_caches();
+    caches.compressed = std::make_unique<compressed_keys>(entries);
+    caches.xonly = std::make_unique<xonly_keys>(entries);
+    caches.enabled.store(true, release);
+}
+
+void disable() NOEXCEPT
+{
+    auto& caches = get_caches();
+    caches.enabled.store(false, release);
+    caches.compressed.reset();
+    caches.xonly.reset();
+}
+
+bool enabled() NOEXCEPT
+{
+    return get_caches().enabled.load(acquire);
+}
+
+digest_set::statistics get_statistics() NOEXCEPT
+{
+    const auto& caches = get_caches();
+    if (!caches.enabled.load(acquire))
+        return {};
+
+    const auto compressed = caches.compressed->statistics();
+    const auto xonly = caches.xonly->statistics();
+    return
+    {
+        compressed.hits + xonly.hits,
+        compressed.misses + xonly.misses,
+        compressed.capacity + xonly.capacity
+    };
+}
+
+} // namespace key_cache
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
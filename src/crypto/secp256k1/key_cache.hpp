@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SECP256K1_KEY_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SECP256K1_KEY_CACHE_HPP
+
+#include <bitcoin/system/crypto/secp256k1.hpp>
+
+#include <secp256k1.h>
+#include <secp256k1_schnorrsig.h>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Parse a compressed public key, via the parsed key cache when enabled.
+bool parse_cached(const secp256k1_context* context, secp256k1_pubkey& out,
+    const ec_compressed& point) NOEXCEPT;
+
+/// Parse an x-only public key, via the parsed key cache when enabled.
+bool parse_cached(const secp256k1_context* context,
+    secp256k1_xonly_pubkey& out, const ec_xonly& point) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -24,6 +24,7 @@
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include "ec_context.hpp"
+#include "key_cache.hpp"
 #include "serialize.hpp"
 
 namespace libbitcoin {
@@ -70,8 +71,7 @@ bool verify_signature(const ec_xonly& x_point, const hash_digest& hash,
     const auto context = ec_context_verify::context();
 
     return
-        secp256k1_xonly_pubkey_parse(context, &pubkey, x_point.data()) ==
-            ec_success && 
+        parse_cached(context, pubkey, x_point) &&
         secp256k1_schnorrsig_verify(context, signature.data(), hash.data(),
             hash_size, &pubkey) == ec_success;
 }
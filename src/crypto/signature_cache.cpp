@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/signature_cache.hpp>
+
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace signature_cache {
+
+// Domain separation of signature types.
+static constexpr uint8_t ecdsa_type = 0x00;
+static constexpr uint8_t schnorr_type = 0x01;
+
+static salted_digest_set& get_cache() NOEXCEPT
+{
+    static salted_digest_set instance{};
+    return instance;
+}
+
+// local
+// Salted sha256 commitment to a typed signature triple.
+static hash_digest commitment(const salted_digest_set& cache, uint8_t type,
+    const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    auto context = cache.context();
+    context.write(one, &type);
+    context.write(hash);
+    context.write(signature);
+    context.write(point.size(), point.data());
+    return context.flush();
+}
+
+// Configuration
+// ----------------------------------------------------------------------------
+
+void enable(size_t entries) NOEXCEPT
+{
+    get_cache().enable(entries);
+}
+
+void disable() NOEXCEPT
+{
+    get_cache().disable();
+}
+
+bool enabled() NOEXCEPT
+{
+    return get_cache().enabled();
+}
+
+digest_set::statistics get_statistics() NOEXCEPT
+{
+    return get_cache().get_statistics();
+}
+
+// Lookup
+// ----------------------------------------------------------------------------
+
+// local
+static bool has(uint8_t type, const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    auto& cache = get_cache();
+    if (!cache.enabled())
+        return false;
+
+    return cache.contains(commitment(cache, type, point, hash,
+        signature));
+}
+
+// local
+static void put(uint8_t type, const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    auto& cache = get_cache();
+    if (!cache.enabled())
+        return;
+
+    cache.insert(commitment(cache, type, point, hash, signature));
+}
+
+bool has_ecdsa(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    return has(ecdsa_type, point, hash, signature);
+}
+
+bool has_schnorr(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    return has(schnorr_type, point, hash, signature);
+}
+
+void put_ecdsa(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    put(ecdsa_type, point, hash, signature);
+}
+
+void put_schnorr(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    put(schnorr_type, point, hash, signature);
+}
+
+} // namespace signature_cache
+} // namespace system
+} // namespace libbitcoin
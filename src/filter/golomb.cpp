@@ -22,7 +22,9 @@
 #include <bitcoin/system/filter/golomb.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -32,6 +34,222 @@
 namespace libbitcoin {
 namespace system {
 
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// local
+// High word of the 128 bit product, in 32 bit limbs (portable).
+constexpr uint64_t multiply_high(uint64_t left, uint64_t right) NOEXCEPT
+{
+    constexpr auto half = bits<uint32_t>;
+    constexpr auto mask = 0x00000000ffffffff_u64;
+    const auto left_lo = bit_and(left, mask), left_hi = shift_right(left, half);
+    const auto right_lo = bit_and(right, mask), right_hi = shift_right(right, half);
+
+    const auto lo_lo = left_lo * right_lo;
+    const auto hi_lo = left_hi * right_lo;
+    const auto lo_hi = left_lo * right_hi;
+    const auto hi_hi = left_hi * right_hi;
+
+    const auto cross = shift_right(lo_lo, half) + bit_and(hi_lo, mask) + lo_hi;
+    return hi_hi + shift_right(hi_lo, half) + shift_right(cross, half);
+}
+
+// local
+// Least significant digit radix sort over the significant bytes of values.
+static void radix_sort(std::vector<uint64_t>& values, uint64_t bound) NOEXCEPT
+{
+    constexpr size_t minimum = 256;
+    if (values.size() < minimum)
+    {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+
+    constexpr size_t digits = power2(byte_bits);
+    std::vector<uint64_t> buffer(values.size());
+    std_array<size_t, digits> counts{};
+
+    const auto passes = ceilinged_divide(bit_width(bound), byte_bits);
+    for (size_t pass{}; pass < passes; ++pass)
+    {
+        const auto shift = to_bits(pass);
+        const auto digit = [=](uint64_t value) NOEXCEPT
+        {
+            return narrow_cast<uint8_t>(shift_right(value, shift));
+        };
+
+        counts.fill(zero);
+        for (const auto value: values)
+            ++counts[digit(value)];
+
+        size_t offset{};
+        for (auto& count: counts)
+            offset += std::exchange(count, offset);
+
+        for (const auto value: values)
+            buffer[counts[digit(value)]++] = value;
+
+        std::swap(values, buffer);
+    }
+}
+
+// local
+// Golomb-Rice encoder to a [bip158] (most significant bit first) stream.
+// Bits are buffered left-aligned and drained a byte at a time, so that each
+// unary quotient and each remainder is written as a single shift.
+class rice_encoder
+{
+public:
+    rice_encoder(data_chunk& out) NOEXCEPT
+      : out_(out)
+    {
+    }
+
+    inline void encode(uint64_t value, uint8_t exponent) NOEXCEPT
+    {
+        BC_ASSERT(exponent <= limit);
+        constexpr auto ones = bits<uint32_t>;
+
+        // Quotient in unary (ones terminated by a zero), limited per write.
+        auto quotient = shift_right(value, exponent);
+        for (; quotient >= ones; quotient -= ones)
+            write(max_uint32, ones);
+
+        write(sub1(shift_left(1_u64, quotient)), quotient);
+        write(0_u64, one);
+        write(bit_and(value, sub1(shift_left(1_u64, exponent))), exponent);
+    }
+
+    // Pad any partial byte with zeros.
+    inline void flush() NOEXCEPT
+    {
+        if (!is_zero(bits_))
+            push();
+
+        bits_ = zero;
+    }
+
+private:
+    // Up to seven bits remain buffered after each write.
+    static constexpr size_t limit = bits<uint64_t> - byte_bits;
+
+    inline void write(uint64_t value, size_t count) NOEXCEPT
+    {
+        if (is_zero(count))
+            return;
+
+        buffer_ |= shift_left(value, bits<uint64_t> - bits_ - count);
+        for (bits_ += count; bits_ >= byte_bits; bits_ -= byte_bits)
+            push();
+    }
+
+    inline void push() NOEXCEPT
+    {
+        out_.push_back(narrow_cast<uint8_t>(shift_right(buffer_,
+            bits<uint64_t> - byte_bits)));
+        buffer_ = shift_left(buffer_, byte_bits);
+    }
+
+    data_chunk& out_;
+    uint64_t buffer_{};
+    size_t bits_{};
+};
+
+// local
+// Golomb-Rice decoder over a [bip158] (most significant bit first) stream.
+// Bits are buffered left-aligned a word at a time, so that each unary
+// quotient is counted as leading ones and each remainder is a single shift.
+class rice_decoder
+{
+public:
+    rice_decoder(const data_slice& data) NOEXCEPT
+      : data_(data.data()), end_(std::next(data.data(), data.size()))
+    {
+    }
+
+    // False if the stream is exhausted (trailing zero or remainder missing).
+    inline bool decode(uint64_t& out, uint8_t exponent) NOEXCEPT
+    {
+        BC_ASSERT(exponent <= capacity);
+
+        uint64_t quotient{};
+        while (true)
+        {
+            fill();
+            const auto ones = std::min(left_ones(buffer_), bits_);
+            quotient += ones;
+            if (ones < bits_)
+            {
+                consume(add1(ones));
+                break;
+            }
+
+            if (data_ == end_)
+                return false;
+
+            consume(ones);
+        }
+
+        fill();
+        if (bits_ < exponent)
+            return false;
+
+        const auto remainder = is_zero(exponent) ? 0_u64 :
+            shift_right(buffer_, bits<uint64_t> - exponent);
+
+        consume(exponent);
+        out = shift_left(quotient, exponent) + remainder;
+        return true;
+    }
+
+private:
+    // Whole bytes that fit in the buffer below its valid bits.
+    static constexpr size_t capacity = bits<uint64_t> - byte_bits;
+
+    inline void consume(size_t count) NOEXCEPT
+    {
+        buffer_ = count < bits<uint64_t> ? shift_left(buffer_, count) : 0_u64;
+        bits_ -= count;
+    }
+
+    inline void fill() NOEXCEPT
+    {
+        if (bits_ > capacity)
+            return;
+
+        const auto size = to_unsigned(std::distance(data_, end_));
+        const auto bytes = (bits<uint64_t> - bits_) / byte_bits;
+
+        // A full word read includes bits of a partial byte below the whole
+        // bytes taken, which are the same bits read by the next fill.
+        if (size >= sizeof(uint64_t))
+        {
+            buffer_ |= shift_right(unsafe_from_big_endian<uint64_t>(data_),
+                bits_);
+            std::advance(data_, bytes);
+            bits_ += to_bits(bytes);
+            return;
+        }
+
+        for (auto byte = std::min(bytes, size); !is_zero(byte); --byte)
+        {
+            buffer_ |= shift_left<uint64_t>(*data_++, capacity - bits_);
+            bits_ += byte_bits;
+        }
+    }
+
+    const uint8_t* data_;
+    const uint8_t* end_;
+    uint64_t buffer_{};
+    size_t bits_{};
+};
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 // Golomb-coded set construction
 // ----------------------------------------------------------------------------
 
@@ -53,13 +271,22 @@ void golomb::construct(bitwriter& writer, const data_stack& items, uint8_t bits,
 data_chunk golomb::construct(const data_stack& items, uint8_t bits,
     const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT
 {
+    const auto set = hashed_set_construct(items, items.size(),
+        target_false_positive_rate, entropy);
+
+    // The size is not known a-priori, but is generally near this.
     data_chunk out{};
+    out.reserve(ceilinged_divide(set.size() * add1(add1(bits)), byte_bits));
+    rice_encoder encoder(out);
+
+    uint64_t previous = 0;
+    for (const auto value: set)
+    {
+        encoder.encode(value - previous, bits);
+        previous = value;
+    }
 
-    // A vector (push) stream is used because the size is not known a-priori.
-    stream::out::data stream(out);
-    write::bits::ostream writer(stream);
-    construct(writer, items, bits, entropy, target_false_positive_rate);
-    writer.flush();
+    encoder.flush();
     return out;
 }
 
@@ -168,6 +395,52 @@ bool golomb::match_stack(const data_chunk& compressed_set,
         bits, target_false_positive_rate);
 }
 
+// Multiple element match
+// ----------------------------------------------------------------------------
+
+bool golomb::match_many(const data_slice& compressed_set,
+    const data_stack& targets, uint64_t set_size, const siphash_key& entropy,
+    uint8_t bits, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    if (targets.empty())
+        return false;
+
+    const auto set = hashed_set_construct(targets, set_size,
+        target_false_positive_rate, entropy);
+
+    rice_decoder decoder(compressed_set);
+    uint64_t delta{}, value{};
+    auto it = set.begin();
+
+    for (uint64_t index = 0; index < set_size; ++index)
+    {
+        if (!decoder.decode(delta, bits))
+            return false;
+
+        value += delta;
+        it = std::find_if(it, set.end(), [=](uint64_t target) NOEXCEPT
+        {
+            return target >= value;
+        });
+
+        if (it == set.end())
+            return false;
+
+        if (*it == value)
+            return true;
+    }
+
+    return false;
+}
+
+bool golomb::match_many(const data_slice& compressed_set,
+    const data_stack& targets, uint64_t set_size, const half_hash& entropy,
+    uint8_t bits, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    return match_many(compressed_set, targets, set_size,
+        to_siphash_key(entropy), bits, target_false_positive_rate);
+}
+
 // private
 // ----------------------------------------------------------------------------
 
@@ -195,9 +468,7 @@ uint64_t golomb::decode(bitreader& reader, uint8_t modulo_exponent) NOEXCEPT
 uint64_t golomb::hash_to_range(const data_slice& item, uint64_t bound,
     const siphash_key& key) NOEXCEPT
 {
-    constexpr auto shift = bits<uint64_t>;
-    const auto product = uint128_t(siphash(key, item)) * uint128_t(bound);
-    return (product >> shift).convert_to<uint64_t>();
+    return multiply_high(siphash(key, item), bound);
 }
 
 std::vector<uint64_t> golomb::hashed_set_construct(const data_stack& items,
@@ -207,15 +478,17 @@ std::vector<uint64_t> golomb::hashed_set_construct(const data_stack& items,
     if (is_multiply_overflow(target_false_positive_rate, set_size))
         return {};
 
-    std::vector<uint64_t> hashes(items.size());
+    // Items are hashed together, vectorized across items where available.
+    auto hashes = siphash(key, items);
     const auto bound = target_false_positive_rate * set_size;
-    std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
+    std::transform(hashes.begin(), hashes.end(), hashes.begin(),
+        [=](uint64_t hash) NOEXCEPT
         {
-            return hash_to_range(item, bound, key);
+            return multiply_high(hash, bound);
         });
 
-    return sort(std::move(hashes));
+    radix_sort(hashes, bound);
+    return hashes;
 }
 
 
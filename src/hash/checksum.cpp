@@ -18,6 +18,9 @@
  */
 #include <bitcoin/system/hash/checksum.hpp>
 
+#include <algorithm>
+#include <array>
+#include <string_view>
 #include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -67,104 +70,152 @@ bool verify_checksum(const data_chunk& data) NOEXCEPT
 
 // bech32 checksum
 // ----------------------------------------------------------------------------
+// Checksum symbols are held as bytes (values < 32) and the BCH polymod is
+// table driven, consuming two symbols per step. The prefix contribution to
+// the polymod is computed once and may be reused across a batch.
 
 static const size_t bech32_version_size = 1;
 static const size_t bech32_checksum_size = 6;
+static const char bech32_separator = '1';
 
-static base32_chunk bech32_expand_prefix(const std::string& prefix) NOEXCEPT
+// BIP173: All versions use 0x00000001 (bech32).
+// BIP350: Nonzero versions use 0x2bc830a3 (bech32m).
+constexpr uint32_t bech32_constant(uint8_t version) NOEXCEPT
 {
-    const auto size = prefix.size();
-    const auto lower = ascii_to_lower(prefix);
-    base32_chunk out(add1(2u * size));
+    return is_zero(version) ? 0x00000001 : 0x2bc830a3;
+}
 
-    for (size_t index = 0; index < size; ++index)
+// Generator combinations for each 5 bit coefficient.
+constexpr std::array<uint32_t, 32> bech32_generators() NOEXCEPT
+{
+    constexpr uint32_t generator[]
     {
-        const char character = lower[index];
-        out[index] = character >> 5;
-        out[size + 1u + index] = character;
-    }
+        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
+    };
+
+    std::array<uint32_t, 32> out{};
+    for (size_t coefficient = 0; coefficient < out.size(); ++coefficient)
+        for (size_t bit = 0; bit < 5u; ++bit)
+            if (get_right(coefficient, bit))
+                out.at(coefficient) ^= generator[bit];
 
-    out[size] = 0x00;
     return out;
 }
 
-static base32_chunk bech32_expand_checksum(uint32_t checksum) NOEXCEPT
+constexpr auto bech32_single = bech32_generators();
+
+// Combined reduction of the top 10 checksum bits over two symbol steps.
+constexpr std::array<uint32_t, 1024> bech32_doubles() NOEXCEPT
 {
-    base32_chunk out(bech32_checksum_size);
-    out[0] = (checksum >> 25);
-    out[1] = (checksum >> 20);
-    out[2] = (checksum >> 15);
-    out[3] = (checksum >> 10);
-    out[4] = (checksum >> 5);
-    out[5] = (checksum >> 0);
+    std::array<uint32_t, 1024> out{};
+    for (size_t top = 0; top < out.size(); ++top)
+    {
+        const auto first = bech32_single.at(top >> 5);
+        const auto second = (top & 0x1f) ^ (first >> 25);
+        out.at(top) = ((first & 0x01ffffff) << 5) ^ bech32_single.at(second);
+    }
+
     return out;
 }
 
-static uint32_t bech32_checksum(const base32_chunk& data) NOEXCEPT
+constexpr auto bech32_double = bech32_doubles();
+
+INLINE constexpr uint32_t bech32_step(uint32_t checksum,
+    uint8_t value) NOEXCEPT
 {
-    uint32_t checksum = 1;
+    return ((checksum & 0x01ffffff) << 5) ^ value ^
+        bech32_single[checksum >> 25];
+}
 
-    for (const auto& value: data)
-    {
-        const uint32_t coeficient = (checksum >> 25);
-        checksum = ((checksum & 0x01ffffff) << 5) ^ value.convert_to<uint8_t>();
-
-        if (coeficient & 0x01) checksum ^= 0x3b6a57b2;
-        if (coeficient & 0x02) checksum ^= 0x26508e6d;
-        if (coeficient & 0x04) checksum ^= 0x1ea119fa;
-        if (coeficient & 0x08) checksum ^= 0x3d4233dd;
-        if (coeficient & 0x10) checksum ^= 0x2a1462b3;
-    }
+INLINE constexpr uint32_t bech32_step(uint32_t checksum, uint8_t first,
+    uint8_t second) NOEXCEPT
+{
+    return ((checksum & 0x000fffff) << 10) ^ (first << 5) ^ second ^
+        bech32_double[checksum >> 20];
+}
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+static uint32_t bech32_polymod(uint32_t checksum, const uint8_t* data,
+    size_t size) NOEXCEPT
+{
+    size_t index = 0;
+    for (; index + 2u <= size; index += 2u)
+        checksum = bech32_step(checksum, data[index], data[add1(index)]);
+
+    if (index < size)
+        checksum = bech32_step(checksum, data[index]);
 
     return checksum;
 }
 
-// BIP173: All versions use 0x00000001 (bech32).
-// BIP350: Nonzero versions use 0x2bc830a3 (bech32m).
-constexpr uint32_t bech32_constant(uint8_t version) NOEXCEPT
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+// Polymod of the expanded (lower case) prefix: [high bits][0][low bits].
+static uint32_t bech32_prefix(const std::string& prefix) NOEXCEPT
 {
-    return is_zero(version) ? 0x00000001 : 0x2bc830a3;
+    const auto lower = ascii_to_lower(prefix);
+    uint32_t checksum = 1;
+
+    for (const auto character: lower)
+        checksum = bech32_step(checksum, to_unsigned(character) >> 5);
+
+    checksum = bech32_step(checksum, 0x00);
+
+    for (const auto character: lower)
+        checksum = bech32_step(checksum, to_unsigned(character) & 0x1f);
+
+    return checksum;
 }
 
-static void bech32_prepend_prefix(base32_chunk& data,
-    const std::string& prefix) NOEXCEPT
+// Append the six checksum symbols to [version][program] symbols.
+static void bech32_append_checksum(data_chunk& symbols, uint32_t prefix,
+    uint8_t version) NOEXCEPT
 {
-    const auto expanded = bech32_expand_prefix(prefix);
-    data.insert(data.begin(), expanded.begin(), expanded.end());
+    auto checksum = bech32_polymod(prefix, symbols.data(), symbols.size());
+    constexpr uint8_t zeros[bech32_checksum_size]{};
+    checksum = bech32_polymod(checksum, &zeros[0], bech32_checksum_size);
+    checksum ^= bech32_constant(version);
+
+    for (auto shift = 25; shift >= 0; shift -= 5)
+        symbols.push_back(narrow_cast<uint8_t>((checksum >> shift) & 0x1f));
 }
 
-static void bech32_append_checksum(base32_chunk& data,
-    const std::string& prefix, uint8_t version) NOEXCEPT
+// Expand version and program to checked symbols, empty if version overflow.
+static bool bech32_build(data_chunk& symbols, uint32_t prefix,
+    uint8_t version, const data_slice& program) NOEXCEPT
 {
-    base32_chunk prefixed{ data };
-    bech32_prepend_prefix(prefixed, prefix);
-    prefixed.resize(prefixed.size() + bech32_checksum_size, 0x00);
-    const auto checksum = bech32_checksum(prefixed) ^ bech32_constant(version);
-    const auto checked = bech32_expand_checksum(checksum);
-    data.insert(data.end(), checked.begin(), checked.end());
+    // Version expansion would truncate a value above 5 bits.
+    if (version >= (1 << 5))
+        return false;
+
+    // Scratch capacity is retained across calls, so batches do not allocate.
+    base32_unpack(symbols, program);
+    symbols.insert(symbols.begin(), version);
+    bech32_append_checksum(symbols, prefix, version);
+    return true;
 }
 
-static bool bech32_verify_checksum(const base32_chunk& checked,
-    const std::string& prefix, uint8_t version) NOEXCEPT
+static bool bech32_verify(uint32_t prefix, const data_chunk& symbols) NOEXCEPT
 {
-    base32_chunk prefixed{ checked };
-    bech32_prepend_prefix(prefixed, prefix);
-    return bech32_checksum(prefixed) == bech32_constant(version);
+    const auto version = symbols.front();
+    const auto checksum = bech32_polymod(prefix, symbols.data(),
+        symbols.size());
+
+    return checksum == bech32_constant(version);
 }
 
 base32_chunk bech32_build_checked(uint8_t version, const data_chunk& program,
     const std::string& prefix) NOEXCEPT
 {
-    // Version expansion would truncate a value above 5 bits.
-    if (version >= (1 << 5))
+    data_chunk symbols;
+    if (!bech32_build(symbols, bech32_prefix(prefix), version, program))
         return {};
 
-    auto checked = base32_unpack(program);
-    checked.insert(checked.begin(), static_cast<uint5_t>(version));
-    bech32_append_checksum(checked, prefix, version);
-    BC_ASSERT(bech32_verify_checksum(checked, prefix, version));
-
-    return checked;
+    BC_ASSERT(bech32_verify(bech32_prefix(prefix), symbols));
+    return { symbols.begin(), symbols.end() };
 }
 
 bool bech32_verify_checked(uint8_t& out_version, data_chunk& out_program,
@@ -173,14 +224,101 @@ bool bech32_verify_checked(uint8_t& out_version, data_chunk& out_program,
     if (checked.size() < bech32_version_size + bech32_checksum_size)
         return false;
 
-    out_version = checked.front().convert_to<uint8_t>();
-    out_program = base32_pack(
+    data_chunk symbols(checked.size());
+    std::transform(checked.begin(), checked.end(), symbols.begin(),
+        [](const uint5_t& value) NOEXCEPT
+        {
+            return value.convert_to<uint8_t>();
+        });
+
+    out_version = symbols.front();
+    base32_pack(out_program,
     {
-        std::next(checked.begin(), bech32_version_size),
-        std::prev(checked.end(), bech32_checksum_size)
+        std::next(symbols.begin(), bech32_version_size),
+        std::prev(symbols.end(), bech32_checksum_size)
     });
 
-    return bech32_verify_checksum(checked, prefix, out_version);
+    return bech32_verify(bech32_prefix(prefix), symbols);
+}
+
+// bech32 batch
+// ----------------------------------------------------------------------------
+
+string_list bech32_encode_many(const std::string& prefix,
+    const data_chunk& versions, const data_stack& programs) NOEXCEPT
+{
+    if (versions.size() != programs.size())
+        return {};
+
+    const auto lower = ascii_to_lower(prefix);
+    const auto state = bech32_prefix(lower);
+    string_list out(programs.size());
+    data_chunk symbols;
+
+    for (size_t index = 0; index < programs.size(); ++index)
+    {
+        if (!bech32_build(symbols, state, versions.at(index),
+            programs.at(index)))
+            continue;
+
+        auto& address = out.at(index);
+        address.reserve(add1(lower.size()) + symbols.size());
+        address.assign(lower);
+        address.push_back(bech32_separator);
+
+        encode_base32_symbols(address, symbols);
+    }
+
+    return out;
+}
+
+bool bech32_decode_many(data_chunk& out_versions, data_stack& out_programs,
+    const std::string& prefix, const string_list& addresses) NOEXCEPT
+{
+    const auto lower = ascii_to_lower(prefix);
+    const auto state = bech32_prefix(lower);
+    const auto head = add1(lower.size());
+    out_versions.resize(addresses.size());
+    out_programs.resize(addresses.size());
+    data_chunk symbols;
+
+    const auto fail = [&]() NOEXCEPT
+    {
+        out_versions.clear();
+        out_programs.clear();
+        return false;
+    };
+
+    for (size_t index = 0; index < addresses.size(); ++index)
+    {
+        const std::string_view address{ addresses.at(index) };
+        if (address.size() < head + bech32_version_size +
+            bech32_checksum_size || has_mixed_ascii_case(address))
+            return fail();
+
+        // All upper case is allowed, so prefix comparison is lowered.
+        if (!std::equal(lower.begin(), lower.end(), address.begin(),
+            [](char expected, char character) NOEXCEPT
+            {
+                return expected == (is_ascii_upper(character) ?
+                    static_cast<char>(character + ('a' - 'A')) : character);
+            }) || address.at(lower.size()) != bech32_separator)
+            return fail();
+
+        if (!decode_base32_symbols(symbols, address.substr(head)) ||
+            !bech32_verify(state, symbols))
+            return fail();
+
+        out_versions.at(index) = symbols.front();
+        if (!base32_pack(out_programs.at(index),
+        {
+            std::next(symbols.begin(), bech32_version_size),
+            std::prev(symbols.end(), bech32_checksum_size)
+        }))
+            return fail();
+    }
+
+    return true;
 }
 
 } // namespace system
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/digest_set.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <bitcoin/system/crypto/pseudo_random.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/functions.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+static constexpr auto relaxed = std::memory_order_relaxed;
+static constexpr auto acquire = std::memory_order_acquire;
+static constexpr auto release = std::memory_order_release;
+
+digest_set::digest_set(size_t entries) NOEXCEPT
+  : mask_(sub1(std::bit_ceil(std::max(one,
+        ceilinged_divide(entries, ways))))),
+    slots_(add1(mask_) * ways)
+{
+}
+
+bool digest_set::contains(const hash_digest& digest) NOEXCEPT
+{
+    const auto value = to_entry(digest);
+    auto& counter = counters_[value[0] % shards];
+    const auto found = find(first(value), value) ||
+        find(second(value), value);
+
+    if (found)
+        counter.hits.fetch_add(one, relaxed);
+    else
+        counter.misses.fetch_add(one, relaxed);
+
+    return found;
+}
+
+void digest_set::insert(const hash_digest& digest) NOEXCEPT
+{
+    const auto value = to_entry(digest);
+    const auto bucket1 = first(value);
+    const auto bucket2 = second(value);
+    if (find(bucket1, value) || find(bucket2, value))
+        return;
+
+    if (const auto way = vacancy(bucket1); way != ways)
+    {
+        slot_at(bucket1, way).write(value);
+        return;
+    }
+
+    if (const auto way = vacancy(bucket2); way != ways)
+    {
+        slot_at(bucket2, way).write(value);
+        return;
+    }
+
+    // Victim way and bucket are selected by otherwise unused entry bits.
+    const auto bucket = get_right(value[3], zero) ? bucket2 : bucket1;
+    auto& victim = slot_at(bucket, value[2] % ways);
+
+    // Relocate the victim to its alternate bucket if it has a vacancy.
+    entry displaced{};
+    if (victim.read(displaced))
+    {
+        const auto alternate = (first(displaced) == bucket) ?
+            second(displaced) : first(displaced);
+
+        if (const auto way = vacancy(alternate); way != ways)
+            slot_at(alternate, way).write(displaced);
+    }
+
+    victim.write(value);
+}
+
+size_t digest_set::capacity() const NOEXCEPT
+{
+    return slots_.size();
+}
+
+digest_set::statistics digest_set::get_statistics() const NOEXCEPT
+{
+    statistics out{};
+    for (const auto& counter: counters_)
+    {
+        out.hits += counter.hits.load(relaxed);
+        out.misses += counter.misses.load(relaxed);
+    }
+
+    out.capacity = capacity();
+    return out;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+digest_set::entry digest_set::to_entry(const hash_digest& digest) NOEXCEPT
+{
+    entry out{};
+    std::memcpy(out.data(), digest.data(), hash_size);
+    return out;
+}
+
+size_t digest_set::first(const entry& value) const NOEXCEPT
+{
+    return possible_narrow_cast<size_t>(value[0]) & mask_;
+}
+
+size_t digest_set::second(const entry& value) const NOEXCEPT
+{
+    return possible_narrow_cast<size_t>(value[1]) & mask_;
+}
+
+digest_set::slot& digest_set::slot_at(size_t bucket, size_t way) NOEXCEPT
+{
+    return slots_[bucket * ways + way];
+}
+
+// Empty way of the bucket, or ways if none.
+size_t digest_set::vacancy(size_t bucket) NOEXCEPT
+{
+    for (size_t way{}; way < ways; ++way)
+        if (slot_at(bucket, way).empty())
+            return way;
+
+    return ways;
+}
+
+bool digest_set::find(size_t bucket, const entry& value) NOEXCEPT
+{
+    entry stored{};
+    for (size_t way{}; way < ways; ++way)
+        if (slot_at(bucket, way).read(stored) && stored == value)
+            return true;
+
+    return false;
+}
+
+// salted_digest_set
+// ----------------------------------------------------------------------------
+
+salted_digest_set::salted_digest_set() NOEXCEPT
+{
+}
+
+void salted_digest_set::enable(size_t entries) NOEXCEPT
+{
+    disable();
+    if (is_zero(entries))
+        return;
+
+    data_array<64> salt{};
+    pseudo_random::fill(salt);
+
+    set_ = std::make_unique<digest_set>(entries);
+    salted_.reset();
+    salted_.write(salt);
+    enabled_.store(true, release);
+}
+
+void salted_digest_set::disable() NOEXCEPT
+{
+    enabled_.store(false, release);
+    set_.reset();
+}
+
+bool salted_digest_set::enabled() const NOEXCEPT
+{
+    return enabled_.load(acquire);
+}
+
+digest_set::statistics salted_digest_set::get_statistics() const NOEXCEPT
+{
+    if (!enabled())
+        return {};
+
+    return set_->get_statistics();
+}
+
+accumulator<sha256> salted_digest_set::context() const NOEXCEPT
+{
+    return salted_;
+}
+
+bool salted_digest_set::contains(const hash_digest& commitment) NOEXCEPT
+{
+    if (!enabled())
+        return false;
+
+    return set_->contains(commitment);
+}
+
+void salted_digest_set::insert(const hash_digest& commitment) NOEXCEPT
+{
+    if (!enabled())
+        return;
+
+    set_->insert(commitment);
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -21,14 +21,15 @@
 
 #include <bitcoin/system/hash/siphash.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/endian/endian.hpp>
-
-// This would be circular a /hash include (must stay in cpp).
-#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -73,6 +74,37 @@ constexpr void compression_round(uint64_t& v0, uint64_t& v1, uint64_t& v2,
     v0 ^= word;
 }
 
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+constexpr auto word_bytes = sizeof(uint64_t);
+constexpr auto word_bits = bits<uint64_t>;
+
+// local
+// Full words and the final (zero to seven bytes) word, which carries the size.
+constexpr size_t sip_words(size_t bytes) NOEXCEPT
+{
+    return add1(bytes / word_bytes);
+}
+
+// local
+// Word of the message at index, with the final word padded as above.
+inline uint64_t sip_word(const uint8_t* message, size_t bytes,
+    size_t index) NOEXCEPT
+{
+    const auto start = index * word_bytes;
+    const auto data = std::next(message, start);
+    if (start + word_bytes <= bytes)
+        return unsafe_from_little_endian<uint64_t>(data);
+
+    uint64_t last{};
+    for (size_t byte{}; byte < bytes - start; ++byte)
+        last |= shift_left<uint64_t>(data[byte], to_bits(byte));
+
+    const auto size = bytes % max_encoded_byte_count;
+    return last ^ shift_left<uint64_t>(size, to_bits(sub1(word_bytes)));
+}
+
 uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
 {
     auto v0 = siphash_magic_0 ^ std::get<0>(key);
@@ -80,21 +112,11 @@ uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
     auto v2 = siphash_magic_2 ^ std::get<0>(key);
     auto v3 = siphash_magic_3 ^ std::get<1>(key);
 
-    constexpr auto eight = sizeof(uint64_t);
     const auto bytes = message.size();
-    stream::in::fast stream(message);
-    read::bytes::fast source(stream);
-
-    for (size_t index = eight; index <= bytes; index += eight)
-        compression_round(v0, v1, v2, v3, source.read_8_bytes_little_endian());
-
-    // Read zero to seven remainder bytes (zero padded, fails stream).
-    BC_ASSERT(source);
-    auto last = source.read_8_bytes_little_endian();
-    BC_ASSERT(!source);
-
-    last ^= ((bytes % max_encoded_byte_count) << to_bits(sub1(eight)));
-    compression_round(v0, v1, v2, v3, last);
+    const auto words = sip_words(bytes);
+    for (size_t index{}; index < words; ++index)
+        compression_round(v0, v1, v2, v3,
+            sip_word(message.data(), bytes, index));
 
     v2 ^= finalization;
     sip_round(v0, v1, v2, v3);
@@ -105,10 +127,152 @@ uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
     return v0 ^ v1 ^ v2 ^ v3;
 }
 
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 uint64_t siphash(const half_hash& hash, const data_slice& message) NOEXCEPT
 {
     return siphash(to_siphash_key(hash), message);
 }
 
+// Vectorized (one message per lane).
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// local
+template <typename xWord>
+INLINE void xsip_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3) NOEXCEPT
+{
+    v0 = f::add<word_bits>(v0, v1);
+    v2 = f::add<word_bits>(v2, v3);
+    v1 = f::rol<13, word_bits>(v1);
+    v3 = f::rol<16, word_bits>(v3);
+    v1 = f::xor_(v1, v0);
+    v3 = f::xor_(v3, v2);
+
+    v0 = f::rol<32, word_bits>(v0);
+
+    v2 = f::add<word_bits>(v2, v1);
+    v0 = f::add<word_bits>(v0, v3);
+    v1 = f::rol<17, word_bits>(v1);
+    v3 = f::rol<21, word_bits>(v3);
+    v1 = f::xor_(v1, v2);
+    v3 = f::xor_(v3, v0);
+
+    v2 = f::rol<32, word_bits>(v2);
+}
+
+// local
+// Lanes are masked out once their messages are compressed, retaining state.
+template <typename xWord>
+INLINE void xcompression_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3,
+    xWord word, xWord mask) NOEXCEPT
+{
+    const auto blend = [mask](xWord prior, xWord next) NOEXCEPT
+    {
+        return f::xor_(prior, f::and_(mask, f::xor_(next, prior)));
+    };
+
+    auto x0 = v0, x1 = v1, x2 = v2, x3 = f::xor_(v3, word);
+    xsip_round(x0, x1, x2, x3);
+    xsip_round(x0, x1, x2, x3);
+    x0 = f::xor_(x0, word);
+
+    v0 = blend(v0, x0);
+    v1 = blend(v1, x1);
+    v2 = blend(v2, x2);
+    v3 = blend(v3, x3);
+}
+
+// local
+// Hashes lane groups of messages taken in order, which is by descending size.
+template <typename xWord, if_extended<xWord> = true>
+INLINE void siphash_vector(std::vector<uint64_t>& out, const siphash_key& key,
+    const data_stack& messages, const std::vector<size_t>& order,
+    size_t& next) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, uint64_t>;
+
+    if constexpr (have<xWord>)
+    {
+        const auto v0_ = f::broadcast<xWord>(siphash_magic_0 ^ std::get<0>(key));
+        const auto v1_ = f::broadcast<xWord>(siphash_magic_1 ^ std::get<1>(key));
+        const auto v2_ = f::broadcast<xWord>(siphash_magic_2 ^ std::get<0>(key));
+        const auto v3_ = f::broadcast<xWord>(siphash_magic_3 ^ std::get<1>(key));
+        const auto final = f::broadcast<xWord>(finalization);
+
+        alignas(xWord) std_array<uint64_t, lanes> words{};
+        alignas(xWord) std_array<uint64_t, lanes> masks{};
+
+        for (; order.size() - next >= lanes; next += lanes)
+        {
+            const auto group = std::next(order.data(), next);
+            const auto count = sip_words(messages[group[0]].size());
+            auto v0 = v0_, v1 = v1_, v2 = v2_, v3 = v3_;
+
+            for (size_t index{}; index < count; ++index)
+            {
+                for (size_t lane{}; lane < lanes; ++lane)
+                {
+                    const auto& message = messages[group[lane]];
+                    const auto active = index < sip_words(message.size());
+                    words[lane] = active ?
+                        sip_word(message.data(), message.size(), index) : 0;
+                    masks[lane] = active ? max_uint64 : 0;
+                }
+
+                xcompression_round(v0, v1, v2, v3,
+                    f::load(array_cast<xWord>(words).front()),
+                    f::load(array_cast<xWord>(masks).front()));
+            }
+
+            v2 = f::xor_(v2, final);
+            xsip_round(v0, v1, v2, v3);
+            xsip_round(v0, v1, v2, v3);
+            xsip_round(v0, v1, v2, v3);
+            xsip_round(v0, v1, v2, v3);
+
+            f::store(array_cast<xWord>(words).front(),
+                f::xor_(f::xor_(v0, v1), f::xor_(v2, v3)));
+
+            for (size_t lane{}; lane < lanes; ++lane)
+                out[group[lane]] = words[lane];
+        }
+    }
+}
+
+std::vector<uint64_t> siphash(const siphash_key& key,
+    const data_stack& messages) NOEXCEPT
+{
+    std::vector<uint64_t> out(messages.size());
+
+    // Descending word count minimizes masked (idle) lanes within each group.
+    std::vector<size_t> order(messages.size());
+    std::iota(order.begin(), order.end(), zero);
+    std::stable_sort(order.begin(), order.end(),
+        [&](size_t left, size_t right) NOEXCEPT
+        {
+            return sip_words(messages[left].size()) >
+                sip_words(messages[right].size());
+        });
+
+    auto next = zero;
+    siphash_vector<xint512_t>(out, key, messages, order, next);
+    siphash_vector<xint256_t>(out, key, messages, order, next);
+    siphash_vector<xint128_t>(out, key, messages, order, next);
+
+    for (; next < order.size(); ++next)
+        out[order[next]] = siphash(key, messages[order[next]]);
+
+    return out;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 } // namespace system
 } // namespace libbitcoin
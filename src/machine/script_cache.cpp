@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/script_cache.hpp>
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+namespace script_cache {
+
+static salted_digest_set& get_cache() NOEXCEPT
+{
+    static salted_digest_set instance{};
+    return instance;
+}
+
+// local
+// Salted sha256 commitment to an input validation.
+static hash_digest commitment(const salted_digest_set& cache,
+    const hash_digest& wtxid, uint32_t index, uint32_t flags) NOEXCEPT
+{
+    auto context = cache.context();
+    context.write(wtxid);
+    context.write(to_little_endian(index));
+    context.write(to_little_endian(flags));
+    return context.flush();
+}
+
+// Configuration
+// ----------------------------------------------------------------------------
+
+void enable(size_t entries) NOEXCEPT
+{
+    get_cache().enable(entries);
+}
+
+void disable() NOEXCEPT
+{
+    get_cache().disable();
+}
+
+bool enabled() NOEXCEPT
+{
+    return get_cache().enabled();
+}
+
+digest_set::statistics get_statistics() NOEXCEPT
+{
+    return get_cache().get_statistics();
+}
+
+// Lookup
+// ----------------------------------------------------------------------------
+
+bool has(const hash_digest& wtxid, uint32_t index, uint32_t flags) NOEXCEPT
+{
+    auto& cache = get_cache();
+    if (!cache.enabled())
+        return false;
+
+    return cache.contains(commitment(cache, wtxid, index, flags));
+}
+
+void put(const hash_digest& wtxid, uint32_t index, uint32_t flags) NOEXCEPT
+{
+    auto& cache = get_cache();
+    if (!cache.enabled())
+        return;
+
+    cache.insert(commitment(cache, wtxid, index, flags));
+}
+
+} // namespace script_cache
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
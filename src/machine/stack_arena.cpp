@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/stack_arena.hpp>
+
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// static
+stack_arena* stack_arena::get() NOEXCEPT
+{
+    static thread_local stack_arena resource{};
+    return &resource;
+}
+
+void* stack_arena::start(size_t) NOEXCEPT
+{
+    offset_ = zero;
+    return buffer_.data();
+}
+
+size_t stack_arena::detach() NOEXCEPT
+{
+    return offset_;
+}
+
+void stack_arena::release(void*) NOEXCEPT
+{
+}
+
+void* stack_arena::do_allocate(size_t bytes, size_t align) THROWS
+{
+    // Align is a power of two, so padding is the negated offset modulo align.
+    const auto padding = bit_and(zero - offset_, sub1(align));
+    const auto space = capacity - offset_;
+
+    if (padding > space || bytes > (space - padding))
+        return default_arena::get()->allocate(bytes, align);
+
+    const auto memory = std::next(buffer_.data(), offset_ + padding);
+    offset_ += (padding + bytes);
+    return memory;
+}
+
+void stack_arena::do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT
+{
+    const auto address = static_cast<const uint8_t*>(ptr);
+    if (address >= buffer_.data() && address < std::next(buffer_.data(),
+        capacity))
+        return;
+
+    default_arena::get()->deallocate(ptr, bytes, align);
+}
+
+bool stack_arena::do_is_equal(const arena& other) const NOEXCEPT
+{
+    // Do not cross the streams.
+    return &other == this;
+}
+
+BC_POP_WARNING()
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/standard.hpp>
+
+#include <iterator>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/number_boolean.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+namespace standard {
+
+using namespace chain;
+
+// Legacy and segwit programs are constructed without the bip342 flag.
+static constexpr auto bip342_mask = bit_not<uint32_t>(flags::bip342_rule);
+
+// Helpers.
+// ----------------------------------------------------------------------------
+
+// The output script leaves its last push on the stack, which must be true.
+static bool is_true(const data_chunk& push) NOEXCEPT
+{
+    return number::boolean::from_chunk(push);
+}
+
+static bool is_hash(const data_chunk& point, const data_chunk& hash) NOEXCEPT
+{
+    return bitcoin_short_hash(point) ==
+        unsafe_array_cast<uint8_t, short_hash_size>(hash.data());
+}
+
+// BIP341: defined types: 0x01, 0x02, 0x03, 0x81, 0x82, or 0x83 (zero is the
+// default and cannot be explicit).
+static constexpr bool is_schnorr_sighash(uint8_t sighash_flags) NOEXCEPT
+{
+    switch (sighash_flags)
+    {
+        case coverage::hash_all:
+        case coverage::hash_none:
+        case coverage::hash_single:
+        case coverage::all_anyone_can_pay:
+        case coverage::none_anyone_can_pay:
+        case coverage::single_anyone_can_pay:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Key path spends execute this script (its content is not committed).
+static const script& checksig_script() NOEXCEPT
+{
+    static const script cached{ { { opcode::checksig } } };
+    return cached;
+}
+
+// Successful verifications are cached for subsequent (block) use.
+static bool verify_ecdsa(const data_chunk& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    if (signature_cache::has_ecdsa(point, hash, signature))
+        return true;
+
+    if (!ecdsa::verify_signature(point, hash, signature))
+        return false;
+
+    signature_cache::put_ecdsa(point, hash, signature);
+    return true;
+}
+
+static bool verify_schnorr(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    if (signature_cache::has_schnorr(point, hash, signature))
+        return true;
+
+    if (!schnorr::verify_signature(point, hash, signature))
+        return false;
+
+    signature_cache::put_schnorr(point, hash, signature);
+    return true;
+}
+
+// Equivalent to a successful op_check_sig (pushing true) without bip342.
+static bool check_ecdsa(const transaction& tx, const input_iterator& it,
+    const script& subscript, const data_chunk& endorsement,
+    const data_chunk& point, uint64_t value, script_version version,
+    uint32_t active_flags) NOEXCEPT
+{
+    if (endorsement.empty())
+        return false;
+
+    // Split endorsement into DER signature and signature hash flags.
+    const auto sighash_flags = endorsement.back();
+    const data_slice der{ endorsement.begin(), std::prev(endorsement.end()) };
+    const auto bip66 = script::is_enabled(active_flags, flags::bip66_rule);
+
+    ec_signature signature{};
+    if (!ecdsa::decode_signature(signature, der, bip66))
+        return false;
+
+    hash_digest hash{};
+    if (!tx.signature_hash(hash, it, subscript, value, {}, version,
+        sighash_flags, active_flags))
+        return false;
+
+    return verify_ecdsa(point, hash, signature);
+}
+
+// Verifiers.
+// ----------------------------------------------------------------------------
+
+// input script  : <endorsement> <public-key>
+// output script : dup hash160 <20-byte-hash-of-public-key> equalverify checksig
+bool verify_pay_key_hash(const context& state, const transaction& tx,
+    const input_iterator& it) NOEXCEPT
+{
+    const auto& input = **it;
+    BC_ASSERT(input.prevout);
+
+    const auto& prevout = input.prevout->script();
+    const auto& outs = prevout.ops();
+    const auto& ins = input.script().ops();
+
+    // A non-witness program must have empty witness field [bip141].
+    if (!script::is_pay_key_hash_pattern(outs) ||
+        !script::is_sign_key_hash_pattern(ins) ||
+        ins.back().is_underflow() ||
+        !input.witness().stack().empty())
+        return false;
+
+    // A 20 byte endorsement may match (and be stripped from) the subscript.
+    const auto& endorsement = ins.front().data();
+    const auto& point = ins.back().data();
+    if (endorsement.size() == short_hash_size ||
+        !is_hash(point, outs[2].data()))
+        return false;
+
+    // The program clears the (mutable) subscript offset of its script.
+    prevout.clear_offset();
+    return check_ecdsa(tx, it, prevout, endorsement, point, max_uint64,
+        script_version::unversioned, bit_and(state.flags, bip342_mask));
+}
+
+// witness stack : <endorsement> <public-key>
+// input script  : (empty)
+// output script : <0> <20-byte-hash-of-public-key>
+bool verify_pay_witness_key_hash(const context& state,
+    const transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    const auto& input = **it;
+    BC_ASSERT(input.prevout);
+
+    const auto flags = state.flags;
+    const auto& prevout = input.prevout->script();
+    const auto& outs = prevout.ops();
+    const auto& stack = input.witness().stack();
+
+    // Endorsements are not stripped from the subscript [bip143].
+    if (!script::is_enabled(flags, flags::bip141_rule) ||
+        !script::is_enabled(flags, flags::bip143_rule) ||
+        !script::is_pay_witness_key_hash_pattern(outs) ||
+        !input.script().ops().empty() ||
+        stack.size() != two)
+        return false;
+
+    // Stack element limit (520) applies to the initial witness [bip141].
+    const auto& program = outs.back().data();
+    const auto& endorsement = *stack.front();
+    const auto& point = *stack.back();
+    if (!is_true(program) ||
+        endorsement.size() > max_push_data_size ||
+        point.size() > max_push_data_size ||
+        !is_hash(point, program))
+        return false;
+
+    const script subscript{ script::to_pay_key_hash_pattern(
+        prevout.witness_program()) };
+    return check_ecdsa(tx, it, subscript, endorsement, point,
+        input.prevout->value(), script_version::segwit,
+        bit_and(flags, bip342_mask));
+}
+
+// witness stack : <signature>
+// input script  : (empty)
+// output script : <1> <32-byte-tweaked-public-key>
+bool verify_pay_taproot_key_path(const context& state,
+    const transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    const auto& input = **it;
+    BC_ASSERT(input.prevout);
+
+    const auto flags = state.flags;
+    const auto& outs = input.prevout->script().ops();
+    const auto& stack = input.witness().stack();
+
+    // A single element precludes an annex [bip341].
+    if (!script::is_enabled(flags, flags::bip141_rule) ||
+        !script::is_enabled(flags, flags::bip341_rule) ||
+        !script::is_enabled(flags, flags::bip342_rule) ||
+        !script::is_pay_witness_taproot_pattern(outs) ||
+        !input.script().ops().empty() ||
+        !is_one(stack.size()))
+        return false;
+
+    const auto& program = outs.back().data();
+    if (!is_true(program))
+        return false;
+
+    // Signature may have sighash byte appended in the usual fashion [bip341].
+    const auto& endorsement = *stack.front();
+    uint8_t sighash_flags{ coverage::hash_default };
+    if (endorsement.size() == add1(ec_signature_size))
+    {
+        sighash_flags = endorsement.back();
+        if (!is_schnorr_sighash(sighash_flags))
+            return false;
+    }
+    else if (endorsement.size() != ec_signature_size)
+    {
+        return false;
+    }
+
+    hash_digest hash{};
+    if (!tx.signature_hash(hash, it, checksig_script(),
+        input.prevout->value(), {}, script_version::taproot, sighash_flags,
+        flags))
+        return false;
+
+    const auto& key = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        program.data());
+    const auto& signature = unsafe_array_cast<uint8_t, ec_signature_size>(
+        endorsement.data());
+    return verify_schnorr(key, hash, signature);
+}
+
+bool verify(const context& state, const transaction& tx,
+    const input_iterator& it) NOEXCEPT
+{
+    return verify_pay_witness_key_hash(state, tx, it)
+        || verify_pay_taproot_key_path(state, tx, it)
+        || verify_pay_key_hash(state, tx, it);
+}
+
+} // namespace standard
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/monotonic_arena.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+#if defined(HAVE_LINUX)
+    #include <sys/mman.h>
+#endif
+
+namespace libbitcoin {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_MALLOC_OR_FREE)
+
+// Round up to a multiple of a power of two (sizes are far below overflow).
+constexpr size_t to_aligned(size_t bytes, size_t align) NOEXCEPT
+{
+    return bit_and(bytes + sub1(align), bit_not(sub1(align)));
+}
+
+// Slab memory begins with its header (next, size), allocations follow.
+constexpr auto header_size = to_aligned(sizeof(void*) + sizeof(size_t),
+    alignof(max_align_t));
+
+static void* allocate_aligned(size_t bytes, size_t align) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    return _aligned_malloc(bytes, align);
+#else
+    return std::aligned_alloc(align, bytes);
+#endif
+}
+
+static void free_aligned(void* ptr) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+// static
+monotonic_arena* monotonic_arena::get() NOEXCEPT
+{
+    static thread_local monotonic_arena resource{};
+    return &resource;
+}
+
+monotonic_arena::monotonic_arena(size_t slab_size, bool huge_pages) NOEXCEPT
+  : slab_size_(to_aligned(std::max(slab_size, page_size),
+        huge_pages ? huge_page_size : page_size)),
+    huge_pages_(huge_pages)
+{
+}
+
+monotonic_arena::~monotonic_arena() NOEXCEPT
+{
+    free_slabs(first_);
+}
+
+void* monotonic_arena::start(size_t baseline) THROWS
+{
+    // The first slab is retained if sufficient, avoiding its reallocation.
+    if (first_ != nullptr && first_->size >= header_size + baseline)
+    {
+        free_slabs(first_->next);
+        first_->next = nullptr;
+        last_ = first_;
+        reserved_ = first_->size;
+    }
+    else
+    {
+        free_slabs(first_);
+        first_ = last_ = nullptr;
+        reserved_ = zero;
+        push(baseline);
+    }
+
+    offset_ = header_size;
+    allocated_ = zero;
+    return first_;
+}
+
+size_t monotonic_arena::detach() NOEXCEPT
+{
+    const auto size = allocated_;
+    first_ = last_ = nullptr;
+    offset_ = allocated_ = reserved_ = zero;
+    return size;
+}
+
+void monotonic_arena::release(void* address) NOEXCEPT
+{
+    free_slabs(static_cast<slab*>(address));
+}
+
+monotonic_arena::statistics monotonic_arena::get_statistics() const NOEXCEPT
+{
+    return { allocated_, reserved_, high_water_ };
+}
+
+// private
+monotonic_arena::slab* monotonic_arena::push(size_t bytes) THROWS
+{
+    const auto align = huge_pages_ ? huge_page_size : page_size;
+    const auto size = std::max(slab_size_, to_aligned(header_size + bytes,
+        align));
+
+    const auto memory = allocate_aligned(size, align);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+
+#if defined(HAVE_LINUX)
+    // Advisory only, transparent huge pages may be disabled.
+    if (huge_pages_)
+        madvise(memory, size, MADV_HUGEPAGE);
+#endif
+
+    const auto next = ::new(memory) slab{ nullptr, size };
+    if (last_ == nullptr)
+        first_ = next;
+    else
+        last_->next = next;
+
+    last_ = next;
+    offset_ = header_size;
+    reserved_ += size;
+    return next;
+}
+
+// private/static
+void monotonic_arena::free_slabs(slab* first) NOEXCEPT
+{
+    while (first != nullptr)
+    {
+        const auto next = first->next;
+        free_aligned(first);
+        first = next;
+    }
+}
+
+void* monotonic_arena::do_allocate(size_t bytes, size_t align) THROWS
+{
+    // Slabs are page aligned, so offset alignment implies address alignment.
+    if (align > page_size)
+        throw std::bad_alloc();
+
+    // Align is a power of two, so padding is the negated offset modulo align.
+    auto padding = bit_and(zero - offset_, sub1(align));
+    if (last_ == nullptr ||
+        offset_ + padding > last_->size ||
+        bytes > last_->size - offset_ - padding)
+    {
+        // The remainder of the current slab is abandoned. The new slab is
+        // sized for worst case padding of its first allocation.
+        push(sub1(align) + bytes);
+        padding = bit_and(zero - offset_, sub1(align));
+    }
+
+    const auto memory = std::next(pointer_cast<uint8_t>(last_), offset_ +
+        padding);
+
+    offset_ += (padding + bytes);
+    allocated_ += (padding + bytes);
+    high_water_ = std::max(high_water_, allocated_);
+    return memory;
+}
+
+void monotonic_arena::do_deallocate(void*, size_t, size_t) NOEXCEPT
+{
+}
+
+bool monotonic_arena::do_is_equal(const arena& other) const NOEXCEPT
+{
+    // Do not cross the streams.
+    return &other == this;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace libbitcoin
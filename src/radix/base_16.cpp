@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/radix/base_16.hpp>
+
+#include <algorithm>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+
+// Runtime base16 conversion. Whole 32 byte (avx2) and 16 byte (sse4) blocks
+// are converted with nibble-shuffle kernels when so compiled, and the
+// remainder (or everything without intrinsics) is converted bytewise.
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+constexpr size_t wide = 32;
+constexpr size_t narrow = 16;
+
+void encode_base16(char* out, const uint8_t* data, size_t size) NOEXCEPT
+{
+    if constexpr (have_avx2)
+    {
+        for (; size >= wide; size -= wide, data += wide)
+        {
+            hex::encode_32(out, data);
+            out += wide * octet_width;
+        }
+    }
+
+    if constexpr (have_sse4)
+    {
+        for (; size >= narrow; size -= narrow, data += narrow)
+        {
+            hex::encode_16(out, data);
+            out += narrow * octet_width;
+        }
+    }
+
+    for (; !is_zero(size); --size, ++data)
+    {
+        *out++ = to_base16_hi_character(*data);
+        *out++ = to_base16_lo_character(*data);
+    }
+}
+
+void encode_hash(char* out, const uint8_t* data, size_t size) NOEXCEPT
+{
+    // Blocks are taken from the end of data, each reversed in register.
+    if constexpr (have_avx2)
+    {
+        for (; size >= wide; size -= wide)
+        {
+            hex::encode_reversed_32(out, data + size - wide);
+            out += wide * octet_width;
+        }
+    }
+
+    if constexpr (have_sse4)
+    {
+        for (; size >= narrow; size -= narrow)
+        {
+            hex::encode_reversed_16(out, data + size - narrow);
+            out += narrow * octet_width;
+        }
+    }
+
+    for (; !is_zero(size); --size)
+    {
+        *out++ = to_base16_hi_character(data[sub1(size)]);
+        *out++ = to_base16_lo_character(data[sub1(size)]);
+    }
+}
+
+bool decode_base16(uint8_t* out, const char* in, size_t size) NOEXCEPT
+{
+    if constexpr (have_avx2)
+    {
+        for (; size >= wide; size -= wide, out += wide)
+        {
+            if (!hex::decode_32(out, in))
+                return false;
+
+            in += wide * octet_width;
+        }
+    }
+
+    if constexpr (have_sse4)
+    {
+        for (; size >= narrow; size -= narrow, out += narrow)
+        {
+            if (!hex::decode_16(out, in))
+                return false;
+
+            in += narrow * octet_width;
+        }
+    }
+
+    for (; !is_zero(size); --size, in += octet_width)
+    {
+        if (!is_base16(in[0]) || !is_base16(in[1]))
+            return false;
+
+        *out++ = from_base16_characters(in[0], in[1]);
+    }
+
+    return true;
+}
+
+bool decode_hash(uint8_t* out, const char* in, size_t size) NOEXCEPT
+{
+    if (!decode_base16(out, in, size))
+        return false;
+
+    std::reverse(out, out + size);
+    return true;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
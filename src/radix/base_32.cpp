@@ -20,7 +20,7 @@
 
 #include <algorithm>
 #include <bitcoin/system/data/data.hpp>
-#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/unicode/unicode.hpp>
 
 // base32
@@ -53,6 +53,16 @@ constexpr uint8_t decode[] =
     6,    4,    2,    0xff, 0xff, 0xff, 0xff, 0xff
 };
 
+// Symbols are regrouped five bytes (eight symbols) at a time through a 40 bit
+// word, which avoids the per-bit cost of the bit reader/writer streams.
+constexpr size_t group_bytes = 5;
+constexpr size_t group_symbols = 8;
+constexpr size_t symbol_bits = 5;
+constexpr uint64_t symbol_mask = 0x1f;
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
 // encode
 
 std::string encode_base32(const base32_chunk& data) NOEXCEPT
@@ -69,7 +79,23 @@ std::string encode_base32(const base32_chunk& data) NOEXCEPT
 
 std::string encode_base32(const data_chunk& data) NOEXCEPT
 {
-    return encode_base32(base32_unpack(data));
+    data_chunk expanded;
+    base32_unpack(expanded, data);
+
+    std::string out;
+    encode_base32_symbols(out, expanded);
+    return out;
+}
+
+void encode_base32_symbols(std::string& out, const data_slice& symbols) NOEXCEPT
+{
+    const auto start = out.size();
+    out.resize(start + symbols.size());
+    auto to = std::next(out.data(), start);
+
+    // encode[] cannot be out of bounds because symbols are masked to < 32.
+    for (const auto symbol: symbols)
+        *to++ = encode[symbol & symbol_mask];
 }
 
 // decode
@@ -98,57 +124,144 @@ bool decode_base32(base32_chunk& out, const std::string& in) NOEXCEPT
 
 bool decode_base32(data_chunk& out, const std::string& in) NOEXCEPT
 {
-    base32_chunk expanded;
-    if (!decode_base32(expanded, in))
+    data_chunk expanded;
+    if (!decode_base32_symbols(expanded, in))
         return false;
 
-    out = base32_pack(expanded);
+    // As with base32_pack(base32_chunk), invalid padding produces empty.
+    base32_pack(out, expanded);
+    return true;
+}
+
+bool decode_base32_symbols(data_chunk& out,
+    const std::string_view& in) NOEXCEPT
+{
+    if (has_mixed_ascii_case(in))
+        return false;
+
+    out.resize(in.size());
+    auto to = out.data();
+
+    // decode[] cannot be out of bounds because char are < 256.
+    for (const auto character: in)
+    {
+        const auto value = decode[static_cast<uint8_t>(character)];
+
+        if (value == 0xff)
+            return false;
+
+        *to++ = value;
+    }
+
     return true;
 }
 
 // pack/unpack
 
-data_chunk base32_pack(const base32_chunk& unpacked) NOEXCEPT
+bool base32_pack(data_chunk& out, const data_slice& unpacked) NOEXCEPT
 {
-    data_chunk packed;
-    write::bits::data sink(packed);
-
-    // This is how C++ developers do it. :)
-    for (const auto& value: unpacked)
-        sink.write_bits(value.convert_to<uint8_t>(), 5);
-
-    sink.flush();
-
-    // Remove an element that is only padding, assumes base32_unpack encoding.
-    // The bit writer writes zeros past end as padding.
-    // This is a ((n * 5) / 8) operation, so (8 - ((n * 5) % 8)) are pad.
-    // This padding is in addition to that added by unpacking. When unpacked
-    // and then packed this will always result in either no pad bits or a full
-    // element of zeros that is padding. This should be apparent from the fact
-    // that the number of used bits is unchanged. Remainder indicates padding.
-    if (!is_zero((unpacked.size() * 5) % 8))
+    const auto size = unpacked.size();
+    const auto data = unpacked.data();
+    out.resize((size * symbol_bits) / byte_bits);
+    auto to = out.data();
+    size_t offset = 0;
+
+    for (; offset + group_symbols <= size; offset += group_symbols)
     {
-        // If pad byte is non-zero the unpacking was not base32_unpack.
-        // So we return an failure where the condition is detecable.
-        packed.resize(packed.back() == 0x00 ? sub1(packed.size()) : 0);
+        uint64_t word = 0;
+        for (size_t symbol = 0; symbol < group_symbols; ++symbol)
+            word = (word << symbol_bits) | (data[offset + symbol] & symbol_mask);
+
+        *to++ = narrow_cast<uint8_t>(word >> 32);
+        *to++ = narrow_cast<uint8_t>(word >> 24);
+        *to++ = narrow_cast<uint8_t>(word >> 16);
+        *to++ = narrow_cast<uint8_t>(word >>  8);
+        *to++ = narrow_cast<uint8_t>(word >>  0);
     }
 
-    return packed;
+    const auto symbols = size - offset;
+    if (is_zero(symbols))
+        return true;
+
+    // Left align the remaining symbols in the 40 bit word.
+    uint64_t word = 0;
+    for (; offset < size; ++offset)
+        word = (word << symbol_bits) | (data[offset] & symbol_mask);
+
+    word <<= (group_symbols - symbols) * symbol_bits;
+    const auto bytes = (symbols * symbol_bits) / byte_bits;
+    for (size_t byte = 0; byte < bytes; ++byte)
+        *to++ = narrow_cast<uint8_t>(word >> (32u - to_bits(byte)));
+
+    // Bits that do not fill a byte are padding, and padding must be zero.
+    const auto padding = to_bits(group_bytes - bytes);
+    if (!is_zero(word & mask_left<uint64_t>(64u - padding)))
+    {
+        out.clear();
+        return false;
+    }
+
+    return true;
 }
 
-base32_chunk base32_unpack(const data_chunk& packed) NOEXCEPT
+void base32_unpack(data_chunk& out, const data_slice& packed) NOEXCEPT
+{
+    const auto size = packed.size();
+    const auto data = packed.data();
+    out.resize(ceilinged_divide(to_bits(size), symbol_bits));
+    auto to = out.data();
+    size_t offset = 0;
+
+    for (; offset + group_bytes <= size; offset += group_bytes)
+    {
+        const auto word =
+            (static_cast<uint64_t>(data[offset + 0]) << 32) |
+            (static_cast<uint64_t>(data[offset + 1]) << 24) |
+            (static_cast<uint64_t>(data[offset + 2]) << 16) |
+            (static_cast<uint64_t>(data[offset + 3]) <<  8) |
+            (static_cast<uint64_t>(data[offset + 4]) <<  0);
+
+        for (auto shift = to_bits(group_bytes); !is_zero(shift);)
+            *to++ = narrow_cast<uint8_t>((word >> (shift -= 5u)) & symbol_mask);
+    }
+
+    const auto bytes = size - offset;
+    if (is_zero(bytes))
+        return;
+
+    // Left align the remaining bytes in the 40 bit word (zero padded).
+    uint64_t word = 0;
+    for (size_t byte = 0; byte < group_bytes; ++byte, ++offset)
+        word = (word << byte_bits) | (offset < size ? data[offset] : 0u);
+
+    const auto symbols = ceilinged_divide(to_bits(bytes), symbol_bits);
+    for (size_t symbol = 0; symbol < symbols; ++symbol)
+        *to++ = narrow_cast<uint8_t>((word >> (35u - symbol * 5u)) &
+            symbol_mask);
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+data_chunk base32_pack(const base32_chunk& unpacked) NOEXCEPT
 {
-    base32_chunk unpacked;
-    read::bits::copy source(packed);
+    data_chunk symbols(unpacked.size());
+    std::transform(unpacked.begin(), unpacked.end(), symbols.begin(),
+        [](const uint5_t& value) NOEXCEPT
+        {
+            return value.convert_to<uint8_t>();
+        });
 
-    // This is how C++ developers do it. :)
-    while (!source.is_exhausted())
-        unpacked.push_back(source.read_bits(5));
+    data_chunk packed;
+    base32_pack(packed, symbols);
+    return packed;
+}
 
-    // The bit reader reads zeros past end as padding.
-    // This is a ((n * 8) / 5) operation, so ((n * 8) % 5)) bits are pad.
-    ////const auto padded = (packed.size() * 8) % 5 != 0;
-    return unpacked;
+base32_chunk base32_unpack(const data_chunk& packed) NOEXCEPT
+{
+    data_chunk symbols;
+    base32_unpack(symbols, packed);
+    return { symbols.begin(), symbols.end() };
 }
 
 } // namespace system
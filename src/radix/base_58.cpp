@@ -19,23 +19,62 @@
 #include <bitcoin/system/radix/base_58.hpp>
 
 #include <algorithm>
+#include <array>
+#include <span>
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 // base58
 // Base 58 is an ascii data encoding with a domain of 58 symbols (characters).
 // 58 is not a power of 2 so base58 is not a bit mapping.
+//
+// Conversion is performed on 32 bit limbs, five base58 digits (58^5) per limb
+// when encoding and four bytes (2^32) per limb when decoding. This reduces the
+// quadratic carry propagation of the bytewise algorithm by a factor of ~20.
+// 58^10 does not fit a 64 bit product with a 32 bit multiplier, so 58^5 is the
+// largest power that allows portable 64 bit intermediates.
 
 namespace libbitcoin {
 namespace system {
 
-const std::string base58_chars =
+using limb = uint32_t;
+using limbs = std::span<limb>;
+using limb_list = std::vector<limb>;
+
+// Scratch of 32 limbs covers payment addresses (25 bytes, 34 characters)
+// and extended keys (82 bytes, 111 characters) without allocation.
+constexpr size_t stack_limbs = 32;
+using limb_array = std::array<limb, stack_limbs>;
+
+constexpr uint64_t base58 = 58;
+constexpr uint64_t base58_5 = base58 * base58 * base58 * base58 * base58;
+constexpr size_t digits_per_limb = 5;
+constexpr size_t bytes_per_limb = sizeof(limb);
+constexpr char base58_zero = '1';
+constexpr uint8_t base58_invalid = 0xff;
+
+constexpr char base58_chars[] =
     "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
+static_assert(base58_5 == 656'356'768_u64);
+static_assert(to_bits(bytes_per_limb) + ceilinged_log2(base58_5) <= 64u);
+
+constexpr std::array<uint8_t, 256> base58_indexes() NOEXCEPT
+{
+    std::array<uint8_t, 256> out{};
+    out.fill(base58_invalid);
+    for (uint8_t index = 0; index < 58u; ++index)
+        out.at(base58_chars[index]) = index;
+
+    return out;
+}
+
+constexpr auto base58_map = base58_indexes();
+
 bool is_base58(char character) NOEXCEPT
 {
-    // The base58 character list is lexically sorted.
-    return std::binary_search(base58_chars.begin(), base58_chars.end(),
-        character);
+    return base58_map.at(static_cast<uint8_t>(character)) != base58_invalid;
 }
 
 bool is_base58(const std::string& text) NOEXCEPT
@@ -48,20 +87,23 @@ bool is_base58(const std::string& text) NOEXCEPT
     return std::all_of(text.begin(), text.end(), test);
 }
 
-template <typename Data>
-static auto find_first_nonzero(const Data& data) NOEXCEPT ->
-    decltype(data.cbegin())
+// Sizing.
+// ----------------------------------------------------------------------------
+
+// log(256) / log(58^5), rounded up.
+constexpr size_t encode_limbs(size_t bytes) NOEXCEPT
 {
-    auto first_nonzero = data.cbegin();
-    while (first_nonzero != data.end() && is_zero(*first_nonzero))
-        ++first_nonzero;
+    return add1(add1(bytes * 138_size / 100_size) / digits_per_limb);
+}
 
-    return first_nonzero;
+// log(58) / log(2^32), rounded up.
+constexpr size_t decode_limbs(size_t characters) NOEXCEPT
+{
+    return add1(add1(characters * 733_size / 1000_size) / bytes_per_limb);
 }
 
-size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
+static size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
 {
-    // Skip and count leading '1's.
     size_t leading_zeros = 0;
     for (const auto byte: unencoded)
     {
@@ -74,118 +116,252 @@ size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
     return leading_zeros;
 }
 
-void pack_value(data_chunk& indexes, size_t carry) NOEXCEPT
+static size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
 {
-    // Apply "b58 = b58 * 256 + ch".
-    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it)
+    size_t leading_zeros = 0;
+    for (const auto digit: encoded)
     {
-        carry += 256_size * (*it);
-        *it = narrow_cast<uint8_t>(carry % 58_size);
-        carry /= 58_size;
+        if (digit != base58_zero)
+            break;
+
+        ++leading_zeros;
     }
 
-    BC_ASSERT(is_zero(carry));
+    return leading_zeros;
 }
 
-std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+// Encode.
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Apply "b58 = b58 * 2^(8 * size) + value" over little-endian 58^5 limbs.
+INLINE static void pack_limbs(limb* const out, size_t& count, uint64_t value,
+    size_t shift) NOEXCEPT
 {
+    for (size_t index = 0; index < count; ++index)
+    {
+        value += (static_cast<uint64_t>(out[index]) << shift);
+        out[index] = narrow_cast<limb>(value % base58_5);
+        value /= base58_5;
+    }
+
+    for (; !is_zero(value); value /= base58_5)
+        out[count++] = narrow_cast<limb>(value % base58_5);
+}
+
+static void encode(std::string& out, const data_slice& unencoded,
+    const limbs& scratch) NOEXCEPT
+{
+    const auto size = unencoded.size();
     const auto leading_zeros = count_leading_zeros(unencoded);
+    const auto data = std::next(unencoded.data(), leading_zeros);
+    const auto remaining = size - leading_zeros;
+    BC_ASSERT(scratch.size() >= encode_limbs(remaining));
 
-    // size = log(256) / log(58), rounded up.
-    const auto number_nonzero = unencoded.size() - leading_zeros;
-    const auto indexes_size = add1(number_nonzero * 138_size / 100_size);
+    // Consume the leading partial group, then whole big-endian words.
+    const auto partial = remaining % bytes_per_limb;
+    const auto buffer = scratch.data();
+    size_t count = 0;
+    size_t offset = 0;
 
-    // Allocate enough space in big-endian base58 representation.
-    data_chunk indexes(indexes_size, 0x00);
+    if (!is_zero(partial))
+    {
+        uint64_t value = 0;
+        for (; offset < partial; ++offset)
+            value = (value << byte_bits) | data[offset];
 
-    // Process the bytes.
-    for (size_t index = leading_zeros; index < unencoded.size(); ++index)
-        pack_value(indexes, unencoded[index]);
+        pack_limbs(buffer, count, value, to_bits(partial));
+    }
 
-    // Skip leading zeros in base58 result.
-    auto it = find_first_nonzero(indexes);
+    for (; offset < remaining; offset += bytes_per_limb)
+    {
+        const auto word =
+            (static_cast<uint64_t>(data[offset + 0]) << 24) |
+            (static_cast<uint64_t>(data[offset + 1]) << 16) |
+            (static_cast<uint64_t>(data[offset + 2]) <<  8) |
+            (static_cast<uint64_t>(data[offset + 3]) <<  0);
+
+        pack_limbs(buffer, count, word, to_bits(bytes_per_limb));
+    }
 
-    // Translate the result into a string.
-    std::string encoded;
-    const size_t estimated_size = leading_zeros + (indexes.end() - it);
-    encoded.reserve(estimated_size);
-    encoded.assign(leading_zeros, '1');
+    // The top limb is unpadded, each lower limb is five digits.
+    char top[digits_per_limb]{};
+    size_t top_size = 0;
+    if (!is_zero(count))
+        for (auto value = buffer[sub1(count)]; !is_zero(value); value /= 58u)
+            top[top_size++] = base58_chars[value % 58u];
 
-    // Set actual main bytes.
-    for (; it != indexes.end(); ++it)
+    const auto lower = is_zero(count) ? zero : sub1(count);
+    out.clear();
+    out.reserve(leading_zeros + top_size + lower * digits_per_limb);
+    out.assign(leading_zeros, base58_zero);
+
+    while (!is_zero(top_size))
+        out.push_back(top[--top_size]);
+
+    for (auto index = lower; !is_zero(index);)
+    {
+        auto value = buffer[--index];
+        char digits[digits_per_limb]{};
+        for (auto digit = digits_per_limb; !is_zero(digit); value /= 58u)
+            digits[--digit] = base58_chars[value % 58u];
+
+        out.append(&digits[0], digits_per_limb);
+    }
+}
+
+// Decode.
+// ----------------------------------------------------------------------------
+
+// Apply "b256 = b256 * multiplier + value" over little-endian 2^32 limbs.
+INLINE static void unpack_limbs(limb* const out, size_t& count,
+    uint64_t value, uint64_t multiplier) NOEXCEPT
+{
+    for (size_t index = 0; index < count; ++index)
     {
-        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-        BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
-        encoded += base58_chars[*it];
-        BC_POP_WARNING()
-        BC_POP_WARNING()
+        value += out[index] * multiplier;
+        out[index] = narrow_cast<limb>(value);
+        value >>= to_bits(bytes_per_limb);
     }
 
-    return encoded;
+    if (!is_zero(value))
+        out[count++] = narrow_cast<limb>(value);
 }
 
-size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
+static bool decode(data_chunk& out, const std::string& in,
+    const limbs& scratch) NOEXCEPT
 {
-    // Skip and count leading '1's.
-    auto leading_zeros = zero;
-    for (const auto digit: encoded)
+    out.clear();
+    const auto size = in.size();
+    const auto leading_zeros = count_leading_zeros(in);
+    const auto text = std::next(in.data(), leading_zeros);
+    const auto remaining = size - leading_zeros;
+    BC_ASSERT(scratch.size() >= decode_limbs(remaining));
+
+    // Consume the leading partial group, then whole groups of five digits.
+    const auto partial = remaining % digits_per_limb;
+    const auto buffer = scratch.data();
+    size_t count = 0;
+    size_t offset = 0;
+
+    while (offset < remaining)
     {
-        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-        if (digit != base58_chars[0])
-        BC_POP_WARNING()
+        const auto group = is_zero(offset) && !is_zero(partial) ? partial :
+            digits_per_limb;
+
+        uint64_t value = 0;
+        uint64_t multiplier = 1;
+        for (const auto end = offset + group; offset < end; ++offset)
         {
-            break;
+            const auto index = base58_map[static_cast<uint8_t>(text[offset])];
+            if (index == base58_invalid)
+                return false;
+
+            value = value * base58 + index;
+            multiplier *= base58;
         }
 
-        ++leading_zeros;
+        unpack_limbs(buffer, count, value, multiplier);
     }
 
-    return leading_zeros;
+    // The top limb is stripped of leading zeros, each lower limb is 4 bytes.
+    const auto top = is_zero(count) ? 0u : buffer[sub1(count)];
+    const auto top_size = ceilinged_divide(bit_width(top), byte_bits);
+    const auto lower = is_zero(count) ? zero : sub1(count);
+    out.reserve(leading_zeros + top_size + lower * bytes_per_limb);
+    out.assign(leading_zeros, 0x00_u8);
+
+    for (auto byte = top_size; !is_zero(byte);)
+        out.push_back(narrow_cast<uint8_t>(top >> to_bits(--byte)));
+
+    for (auto index = lower; !is_zero(index);)
+    {
+        const auto value = buffer[--index];
+        out.push_back(narrow_cast<uint8_t>(value >> 24));
+        out.push_back(narrow_cast<uint8_t>(value >> 16));
+        out.push_back(narrow_cast<uint8_t>(value >>  8));
+        out.push_back(narrow_cast<uint8_t>(value >>  0));
+    }
+
+    return true;
 }
 
-void unpack_char(data_chunk& data, size_t carry) NOEXCEPT
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+// Interface.
+// ----------------------------------------------------------------------------
+
+std::string encode_base58(const data_slice& unencoded) NOEXCEPT
 {
-    for (auto it = data.rbegin(); it != data.rend(); it++)
+    std::string out{};
+    const auto required = encode_limbs(unencoded.size());
+    if (required <= stack_limbs)
     {
-        carry += 58_size * (*it);
-        *it = narrow_cast<uint8_t>(carry % 256_size);
-        carry /= 256_size;
+        limb_array scratch;
+        encode(out, unencoded, scratch);
+    }
+    else
+    {
+        limb_list scratch(required);
+        encode(out, unencoded, scratch);
     }
 
-    BC_ASSERT(is_zero(carry));
+    return out;
 }
 
 bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT
 {
-    out.clear();
-
-    // Trim spaces and newlines around the string.
-    const auto leading_zeros = count_leading_zeros(in);
+    const auto required = decode_limbs(in.size());
+    if (required <= stack_limbs)
+    {
+        limb_array scratch;
+        return decode(out, in, scratch);
+    }
 
-    // log(58) / log(256), rounded up.
-    const size_t data_size = add1(in.size() * 733_size / 1000_size);
+    limb_list scratch(required);
+    return decode(out, in, scratch);
+}
 
-    // Allocate enough space in big-endian base256 representation.
-    data_chunk data(data_size, 0x00);
+string_list encode_base58_many(const data_stack& unencoded) NOEXCEPT
+{
+    limb_list scratch(stack_limbs);
+    string_list out(unencoded.size());
+    auto item = out.begin();
 
-    // Process the characters.
-    for (auto it = in.begin() + leading_zeros; it != in.end(); ++it)
+    for (const auto& data: unencoded)
     {
-        const auto carry = base58_chars.find(*it);
-        if (carry == std::string::npos)
-            return false;
+        const auto required = encode_limbs(data.size());
+        if (required > scratch.size())
+            scratch.resize(required);
 
-        unpack_char(data, carry);
+        encode(*item++, data, scratch);
     }
 
-    // Skip leading zeros in data.
-    const auto first_nonzero = find_first_nonzero(data);
+    return out;
+}
+
+bool decode_base58_many(data_stack& out, const string_list& in) NOEXCEPT
+{
+    limb_list scratch(stack_limbs);
+    out.resize(in.size());
+    auto item = out.begin();
+
+    for (const auto& text: in)
+    {
+        const auto required = decode_limbs(text.size());
+        if (required > scratch.size())
+            scratch.resize(required);
+
+        if (!decode(*item++, text, scratch))
+        {
+            out.clear();
+            return false;
+        }
+    }
 
-    // Copy result into output vector.
-    const size_t estimated_size = leading_zeros + (data.end() - first_nonzero);
-    out.reserve(estimated_size);
-    out.assign(leading_zeros, 0x00_u8);
-    out.insert(out.end(), first_nonzero, data.cend());
     return true;
 }
 
@@ -22,6 +22,7 @@
 #include <bitcoin/system/wallet/neutrino.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/filter/filter.hpp>
@@ -71,12 +72,15 @@ bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
 
     distinct(scripts);
 
+    // The set follows its (byte aligned) size, so it is constructed apart.
+    const auto set = golomb::construct(scripts, golomb_bits, key, rate);
+
     // A vector (push) stream is used because the size is not known a-priori.
     stream::out::data stream(out);
-    write::bits::ostream writer(stream);
+    write::bytes::ostream writer(stream);
 
     writer.write_variable(scripts.size());
-    golomb::construct(writer, scripts, golomb_bits, key, rate);
+    writer.write_bytes(set);
     writer.flush();
     return !!writer;
 }
@@ -94,24 +98,35 @@ hash_digest compute_header(hash_digest& filter_hash,
     return bitcoin_hash(filter_hash, previous_header);
 }
 
-bool match_filter(const block_filter& filter,
-    const chain::script& script) NOEXCEPT
+// local
+// Targets are matched against the set following its leading set size.
+static bool match_targets(const block_filter& filter,
+    const data_stack& targets) NOEXCEPT
 {
-    if (script.ops().empty())
-        return false;
-
     stream::in::fast stream(filter.filter);
-    read::bits::fast reader(stream);
-    const auto set_size = reader.read_variable();
+    read::bytes::fast source(stream);
+    const auto set_size = source.read_variable();
 
-    if (!reader)
+    if (!source)
         return false;
 
-    const auto target = script.to_data(false);
+    const auto set = std::next(filter.filter.begin(),
+        source.get_read_position());
+
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
 
-    return golomb::match_single(reader, target, set_size, key, golomb_bits, rate);
+    return golomb::match_many({ set, filter.filter.end() }, targets, set_size,
+        key, golomb_bits, rate);
+}
+
+bool match_filter(const block_filter& filter,
+    const chain::script& script) NOEXCEPT
+{
+    if (script.ops().empty())
+        return false;
+
+    return match_targets(filter, { script.to_data(false) });
 }
 
 bool match_filter(const block_filter& filter,
@@ -132,18 +147,7 @@ bool match_filter(const block_filter& filter,
     if (stack.empty())
         return false;
 
-    stream::in::fast stream(filter.filter);
-    read::bits::fast reader(stream);
-    const auto set_size = reader.read_variable();
-
-    if (!reader)
-        return false;
-
-    const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
-    const auto key = to_siphash_key(hash);
-
-    stack.shrink_to_fit();
-    return golomb::match_stack(reader, stack, set_size, key, golomb_bits, rate);
+    return match_targets(filter, stack);
 }
 
 bool match_filter(const block_filter& filter,
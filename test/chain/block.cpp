@@ -158,6 +158,29 @@ BOOST_AUTO_TEST_CASE(block__constructor__fast__success)
     BOOST_REQUIRE(!block.is_invalid_merkle_root());
 }
 
+BOOST_AUTO_TEST_CASE(block__constructor__arena__allocated_by_arena)
+{
+    const auto data = test::mock_block_b.to_data(true);
+    test::reporting_arena<false> arena{};
+    stream::in::fast stream(data);
+    read::bytes::fast source(stream, &arena);
+
+    // Allocations are assigned to the arena (allocation count is variable).
+    auto instance = std::make_unique<const block>(source, true);
+    BOOST_REQUIRE(instance->is_valid());
+    BOOST_REQUIRE(*instance == test::mock_block_b);
+    BOOST_REQUIRE(!is_zero(arena.inc_count));
+
+    const auto& script = instance->transactions_ptr()->front()->
+        outputs_ptr()->front()->script();
+    BOOST_REQUIRE(script.ops().get_allocator().resource() == &arena);
+
+    // All memory is freed through the arena.
+    instance.reset();
+    BOOST_REQUIRE_EQUAL(arena.dec_count, arena.inc_count);
+    BOOST_REQUIRE_EQUAL(arena.dec_bytes, arena.inc_bytes);
+}
+
 BOOST_AUTO_TEST_CASE(block__constructor__stream__success)
 {
     const auto genesis = settings(selection::mainnet).genesis_block;
@@ -303,6 +326,36 @@ BOOST_AUTO_TEST_CASE(block__check__empty__empty_block)
 // accept
 // connect
 
+BOOST_AUTO_TEST_CASE(block__connect_all__missing_prevout__failing_position)
+{
+    const block instance
+    {
+        header{},
+        {
+            { 1, inputs{ {} }, { {} }, 0 },
+            { 1, inputs{ { { null_hash, 0 }, {}, 0 }, { { null_hash, 1 }, {}, 0 } }, {}, 0 }
+        }
+    };
+
+    // Output script that succeeds given an empty input script.
+    const auto& inputs = *instance.transactions_ptr()->back()->inputs_ptr();
+    inputs.front()->prevout = to_shared<output>(0, script{ { opcode::push_positive_1 } });
+
+    size_t tx_index{};
+    uint32_t input_index{};
+    BOOST_REQUIRE_EQUAL(instance.connect_all({}, tx_index, input_index, true), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(tx_index, 1u);
+    BOOST_REQUIRE_EQUAL(input_index, 1u);
+
+    tx_index = input_index = 0;
+    BOOST_REQUIRE_EQUAL(instance.connect_all({}, tx_index, input_index, false), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(tx_index, 1u);
+    BOOST_REQUIRE_EQUAL(input_index, 1u);
+
+    inputs.back()->prevout = inputs.front()->prevout;
+    BOOST_REQUIRE(!instance.connect_all({}, tx_index, input_index));
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,356 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/blocks.hpp"
+
+using namespace boost;
+using namespace bc::system::chain;
+
+BOOST_AUTO_TEST_SUITE(json_writer_tests)
+
+// The mock block, with an unsegregated transaction (and a script underflow).
+static block mixed_block() NOEXCEPT
+{
+    return
+    {
+        test::mock_block_json.header(),
+        transactions
+        {
+            *test::mock_block_json.transactions_ptr()->front(),
+            transaction
+            {
+                1,
+                inputs
+                {
+                    input{ point{ one_hash, 7 }, script{ "[0102] dup" }, 9 }
+                },
+                outputs
+                {
+                    output{ 42, script{ "[1.03] [0405] checksig" } },
+                    output{ 0, script{ base16_chunk("4c05ab"), false } }
+                },
+                11
+            }
+        }
+    };
+}
+
+// objects
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__block__expected)
+{
+    const std::string_view text
+    {
+        "{"
+            R"("header":)"
+            "{"
+                R"("hash":"d5b1048b2dcb443dd79a15e54de994fa18620d1d99250f2a4123660c68dea664",)"
+                R"("version":42,)"
+                R"("previous":"0000000000000000000000000000000000000000000000000000000000000000",)"
+                R"("merkle_root":"0000000000000000000000000000000000000000000000000000000000000001",)"
+                R"("timestamp":43,)"
+                R"("bits":44,)"
+                R"("nonce":45)"
+            "},"
+            R"("transactions":)"
+            "["
+                "{"
+                    R"("hash":"6d74f0162f9c7a3be99cb60cca0c658f3e19fb3462f4c9731d5a0b7495183335",)"
+                    R"("version":42,)"
+                    R"("inputs":)"
+                    "["
+                        "{"
+                            R"("point":)"
+                            "{"
+                                R"("hash":"0000000000000000000000000000000000000000000000000000000000000000",)"
+                                R"("index":24)"
+                            "},"
+                            R"("script":"return pick",)"
+                            R"("witness":"[242424]",)"
+                            R"("sequence":42)"
+                        "},"
+                        "{"
+                            R"("point":)"
+                            "{"
+                                R"("hash":"0000000000000000000000000000000000000000000000000000000000000001",)"
+                                R"("index":42)"
+                            "},"
+                            R"("script":"return roll",)"
+                            R"("witness":"[424242]",)"
+                            R"("sequence":24)"
+                        "}"
+                    "],"
+                    R"("outputs":)"
+                    "["
+                        "{"
+                            R"("value":24,)"
+                            R"("script":"pick")"
+                        "},"
+                        "{"
+                            R"("value":42,)"
+                            R"("script":"roll")"
+                        "}"
+                    "],"
+                    R"("locktime":24)"
+                "}"
+            "]"
+        "}"
+    };
+
+    const auto& instance = test::mock_block_json;
+    BOOST_REQUIRE_EQUAL(to_json(instance), text);
+    BOOST_REQUIRE_EQUAL(to_json(instance), json::serialize(json::value_from(instance)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__mixed_block__tree_serialization)
+{
+    const auto instance = mixed_block();
+    BOOST_REQUIRE_EQUAL(to_json(instance), json::serialize(json::value_from(instance)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__header__expected)
+{
+    const std::string_view text
+    {
+        "{"
+            R"("hash":"d5b1048b2dcb443dd79a15e54de994fa18620d1d99250f2a4123660c68dea664",)"
+            R"("version":42,)"
+            R"("previous":"0000000000000000000000000000000000000000000000000000000000000000",)"
+            R"("merkle_root":"0000000000000000000000000000000000000000000000000000000000000001",)"
+            R"("timestamp":43,)"
+            R"("bits":44,)"
+            R"("nonce":45)"
+        "}"
+    };
+
+    const header instance{ 42, null_hash, one_hash, 43, 44, 45 };
+    BOOST_REQUIRE_EQUAL(to_json(instance), text);
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__unsegregated_transaction__expected)
+{
+    const auto mixed = mixed_block();
+    const auto& instance = *mixed.transactions_ptr()->back();
+    const std::string text
+    {
+        "{"
+            R"("hash":")" + encode_hash(instance.hash(false)) + R"(",)"
+            R"("version":1,)"
+            R"("inputs":)"
+            "["
+                "{"
+                    R"("point":)"
+                    "{"
+                        R"("hash":"0000000000000000000000000000000000000000000000000000000000000001",)"
+                        R"("index":7)"
+                    "},"
+                    R"("script":"[0102] dup",)"
+                    R"("sequence":9)"
+                "}"
+            "],"
+            R"("outputs":)"
+            "["
+                "{"
+                    R"("value":42,)"
+                    R"("script":"[1.03] [0405] checksig")"
+                "},"
+                "{"
+                    R"("value":0,)"
+                    "\"script\":\"(4c05ab)\""
+                "}"
+            "],"
+            R"("locktime":11)"
+        "}"
+    };
+
+    BOOST_REQUIRE_EQUAL(to_json(instance), text);
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__input__expected)
+{
+    const std::string_view text
+    {
+        "{"
+            R"("point":)"
+            "{"
+                R"("hash":"0000000000000000000000000000000000000000000000000000000000000001",)"
+                R"("index":42)"
+            "},"
+            R"("script":"pick roll return",)"
+            R"("witness":"[424242]",)"
+            R"("sequence":24)"
+        "}"
+    };
+
+    const input instance
+    {
+        point{ one_hash, 42 },
+        script{ { { opcode::pick }, { opcode::roll }, { opcode::op_return } } },
+        witness{ "[424242]" },
+        24
+    };
+
+    BOOST_REQUIRE_EQUAL(to_json(instance), text);
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__output__expected)
+{
+    const std::string_view text
+    {
+        "{"
+            R"("value":24,)"
+            R"("script":"pick")"
+        "}"
+    };
+
+    const output instance{ 24, script{ { { opcode::pick } } } };
+    BOOST_REQUIRE_EQUAL(to_json(instance), text);
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__point__expected)
+{
+    const std::string_view text
+    {
+        "{"
+            R"("hash":"0000000000000000000000000000000000000000000000000000000000000001",)"
+            R"("index":42)"
+        "}"
+    };
+
+    const point instance{ one_hash, 42 };
+    BOOST_REQUIRE_EQUAL(to_json(instance), text);
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__script__to_string)
+{
+    // Minimal and explicit size push data, opcodes, and a final underflow.
+    const script instance{ base16_chunk("0201024c01034d020004054e0100000006ac4c"), false };
+    BOOST_REQUIRE(instance.ops().back().is_underflow());
+    BOOST_REQUIRE_EQUAL(to_json(instance), "\"" + instance.to_string(flags::all_rules) + "\"");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__script__expected)
+{
+    const script instance{ "[1.03] [0102] dup" };
+    BOOST_REQUIRE_EQUAL(to_json(instance), R"("[1.03] [0102] dup")");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__witness__expected)
+{
+    const witness instance
+    {
+        data_stack
+        {
+            { 0x42, 0x43, 0x44 },
+            {},
+            { 0x48, 0x49, 0x4a }
+        }
+    };
+
+    BOOST_REQUIRE_EQUAL(to_json(instance), R"("[424344] [] [48494a]")");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__invalid_witness__expected)
+{
+    BOOST_REQUIRE_EQUAL(to_json(witness{}), "\"(?)\"");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__large_witness_element__expected)
+{
+    // Exceeds the writer buffer, in both hex and size.
+    const data_chunk element(10'000, 0x5a);
+    const witness instance{ data_stack{ element } };
+    BOOST_REQUIRE_EQUAL(to_json(instance), "\"[" + encode_base16(element) + "]\"");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__ostream__expected)
+{
+    std::ostringstream stream{};
+    to_json(stream, test::mock_block_json);
+    BOOST_REQUIRE_EQUAL(stream.str(), to_json(test::mock_block_json));
+}
+
+// views
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__block_view__block)
+{
+    const auto data = test::mock_block_json.to_data(true);
+    const block_view view{ data_chunk{ data }, true };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(view), to_json(block{ data, true }));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__mixed_block_view__block)
+{
+    const auto instance = mixed_block();
+    const block_view view{ instance.to_data(true), true };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(view), to_json(instance));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__stripped_block_view__stripped_block)
+{
+    const auto data = mixed_block().to_data(true);
+    const block_view view{ data_chunk{ data }, false };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(view), to_json(block{ data, false }));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__genesis_block_view__block)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const block_view view{ genesis.to_data(true), true };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(view), to_json(genesis));
+    BOOST_REQUIRE_EQUAL(to_json(genesis), json::serialize(json::value_from(genesis)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__transaction_view__transaction)
+{
+    const auto instance = mixed_block();
+    const block_view view{ instance.to_data(true), true };
+    const auto& txs = *instance.transactions_ptr();
+    BOOST_REQUIRE_EQUAL(view.views().size(), txs.size());
+    BOOST_REQUIRE_EQUAL(to_json(view.views().front()), to_json(*txs.front()));
+    BOOST_REQUIRE_EQUAL(to_json(view.views().back()), to_json(*txs.back()));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__truncated_block_view__default_block)
+{
+    // Shorter than a header.
+    const block_view view{ data_chunk{ 0x42, 0x43 }, true };
+    BOOST_REQUIRE(!view.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(view), to_json(block{}));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__invalid_transaction_view__default_transaction)
+{
+    auto buffer = to_chunk(test::header0_data);
+    buffer.push_back(0x42);
+    stream::in::fast istream{ buffer };
+    read::bytes::fast reader{ istream };
+    reader.skip_bytes(header::serialized_size());
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x42u);
+
+    const transaction_view view{ reader, buffer, false, true };
+    BOOST_REQUIRE(!view.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(view), to_json(transaction{}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
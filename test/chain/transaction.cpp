@@ -686,6 +686,92 @@ BOOST_AUTO_TEST_CASE(transaction__signature_operations__empty_input_output__zero
 // accept
 // connect
 
+static transaction connect_transaction(bool populate_second) NOEXCEPT
+{
+    const transaction tx
+    {
+        0,
+        {
+            { { tx1_hash, 0 }, {}, 0 },
+            { { tx2_hash, 0 }, {}, 0 }
+        },
+        {},
+        0
+    };
+
+    // Output script that succeeds given an empty input script.
+    const auto prevout = to_shared<output>(0, script{ { opcode::push_positive_1 } });
+    tx.inputs_ptr()->front()->prevout = prevout;
+    if (populate_second)
+        tx.inputs_ptr()->back()->prevout = prevout;
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect_all__default__success)
+{
+    uint32_t index{ 42 };
+    BOOST_REQUIRE(!transaction{}.connect_all({}, index));
+    BOOST_REQUIRE_EQUAL(index, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect_all__populated__success)
+{
+    uint32_t index{ 42 };
+    const auto instance = connect_transaction(true);
+    BOOST_REQUIRE(!instance.connect_all({}, index, true));
+    BOOST_REQUIRE(!instance.connect_all({}, index, false));
+    BOOST_REQUIRE_EQUAL(index, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect_all__missing_prevout__failing_index)
+{
+    uint32_t index{};
+    const auto instance = connect_transaction(false);
+    BOOST_REQUIRE_EQUAL(instance.connect_all({}, index, true), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(index, 1u);
+
+    index = 0;
+    BOOST_REQUIRE_EQUAL(instance.connect_all({}, index, false), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(index, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect_all__failing_scripts__first_failing_index)
+{
+    const transaction instance
+    {
+        0,
+        {
+            { { tx1_hash, 0 }, {}, 0 },
+            { { tx1_hash, 1 }, {}, 0 },
+            { { tx1_hash, 2 }, {}, 0 },
+            { { tx1_hash, 3 }, {}, 0 }
+        },
+        {},
+        0
+    };
+
+    // Output scripts that succeed/fail given an empty input script.
+    const auto pass = to_shared<output>(0, script{ { opcode::push_positive_1 } });
+    const auto fail = to_shared<output>(0, script{ { opcode::push_size_0 } });
+    const auto& inputs = *instance.inputs_ptr();
+    inputs.at(0)->prevout = pass;
+    inputs.at(1)->prevout = fail;
+    inputs.at(2)->prevout = fail;
+    inputs.at(3)->prevout = pass;
+
+    const auto expected = instance.connect({});
+    BOOST_REQUIRE(expected);
+
+    uint32_t index{};
+    BOOST_REQUIRE_EQUAL(instance.connect_all({}, index, true), expected);
+    BOOST_REQUIRE_EQUAL(index, 1u);
+
+    index = 0;
+    BOOST_REQUIRE_EQUAL(instance.connect_all({}, index, false), expected);
+    BOOST_REQUIRE_EQUAL(index, 1u);
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
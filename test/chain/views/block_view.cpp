@@ -160,6 +160,172 @@ BOOST_AUTO_TEST_CASE(block_view__identify__block1a_witness__expected)
     BOOST_CHECK_EQUAL(ec, error::block_success);
 }
 
+// check and accept
+
+using namespace system::chain;
+
+constexpr auto view_hash1 = base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+constexpr auto view_hash2 = base16_hash("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+// Coinbase script is a nominal push of height one [bip34].
+static const transaction view_coinbase
+{
+    1,
+    { { point{}, script{ base16_chunk("0101"), false }, max_uint32 } },
+    { { 0, script{} } },
+    0
+};
+
+static transaction spend(const hash_digest& hash, uint32_t index,
+    uint32_t locktime=0, uint32_t sequence=max_uint32) NOEXCEPT
+{
+    return { 1, { { { hash, index }, script{}, sequence } },
+        { { 0, script{} } }, locktime };
+}
+
+static block_view to_view(const block& instance) NOEXCEPT
+{
+    return { instance.to_data(true), true };
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__test_blocks__matches_block)
+{
+    using namespace system;
+    constexpr auto rules = flags::bip34_rule | flags::bip50_rule |
+        flags::bip113_rule | flags::bip141_rule;
+
+    for (const auto& instance: { test::genesis, test::block1, test::block2,
+        test::block3, test::block4, test::block5, test::block6, test::block7,
+        test::block8, test::block9, test::block1a, test::block2a,
+        test::block2c })
+    {
+        const auto view = to_view(instance);
+        BOOST_REQUIRE(view.is_valid());
+        BOOST_CHECK_EQUAL(view.weight(), instance.weight());
+        BOOST_CHECK_EQUAL(view.check(), instance.check());
+        BOOST_CHECK_EQUAL(view.check(false), instance.check(false));
+
+        for (const size_t height: { 0u, 1u, 42u })
+        {
+            const context ctx{ rules, 0, 0, height };
+            BOOST_CHECK_EQUAL(view.check(ctx), instance.check(ctx));
+            BOOST_CHECK_EQUAL(view.check(ctx, false), instance.check(ctx, false));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__first_non_coinbase__first_not_coinbase)
+{
+    const block instance{ header{}, { spend(view_hash1, 0) } };
+    BOOST_CHECK_EQUAL(to_view(instance).check(), error::first_not_coinbase);
+    BOOST_CHECK_EQUAL(to_view(instance).check(), instance.check());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__extra_coinbases__extra_coinbases)
+{
+    const block instance{ header{}, { view_coinbase, view_coinbase } };
+    BOOST_CHECK_EQUAL(to_view(instance).check(), error::extra_coinbases);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__forward_reference__forward_reference)
+{
+    const auto to = spend(view_hash2, 0, 42);
+    const auto from = spend(to.hash(false), 0);
+    const block instance{ header{}, { view_coinbase, from, to } };
+    BOOST_CHECK_EQUAL(to_view(instance).check(), error::forward_reference);
+    BOOST_CHECK_EQUAL(to_view(instance).check(), instance.check());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__backward_reference__not_forward_reference)
+{
+    const auto to = spend(view_hash2, 0, 42);
+    const auto from = spend(to.hash(false), 0);
+    const block instance{ header{}, { view_coinbase, to, from } };
+    BOOST_CHECK_NE(to_view(instance).check(), error::forward_reference);
+    BOOST_CHECK_EQUAL(to_view(instance).check(), instance.check());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__distinct_points__not_double_spend)
+{
+    const block instance
+    {
+        header{},
+        {
+            view_coinbase,
+            spend(view_hash1, 42),
+            spend(view_hash1, 27),
+            spend(view_hash2, 42)
+        }
+    };
+
+    BOOST_CHECK_NE(to_view(instance).check(), error::block_internal_double_spend);
+    BOOST_CHECK_EQUAL(to_view(instance).check(), instance.check());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__nondistinct_points__double_spend)
+{
+    const block instance
+    {
+        header{},
+        {
+            view_coinbase,
+            spend(view_hash1, 42),
+            spend(view_hash2, 27),
+            spend(view_hash1, 42, 1)
+        }
+    };
+
+    BOOST_CHECK_EQUAL(to_view(instance).check(), error::block_internal_double_spend);
+    BOOST_CHECK_EQUAL(to_view(instance).check(), instance.check());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__null_point_spend__previous_output_null)
+{
+    const transaction null_spend{ 1, { { point{}, script{}, 0 },
+        { { view_hash1, 0 }, script{}, 0 } }, { { 0, script{} } }, 0 };
+    const block instance{ header{}, { view_coinbase, null_spend } };
+    BOOST_CHECK_EQUAL(to_view(instance).check(false), error::previous_output_null);
+    BOOST_CHECK_EQUAL(to_view(instance).check(false), instance.check(false));
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__context_coinbase_height__expected)
+{
+    const block instance{ header{}, { view_coinbase } };
+    const auto view = to_view(instance);
+    BOOST_CHECK_EQUAL(view.check({ flags::bip34_rule, 0, 0, 1 }), error::block_success);
+    BOOST_CHECK_EQUAL(view.check({ flags::bip34_rule, 0, 0, 2 }), error::coinbase_height_mismatch);
+    BOOST_CHECK_EQUAL(view.check({ flags::no_rules, 0, 0, 2 }), error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__check__context_absolute_locked__expected)
+{
+    // Height-based locktime with a non-final sequence.
+    const block instance{ header{}, { view_coinbase, spend(view_hash1, 0, 42, 0) } };
+    const auto view = to_view(instance);
+    BOOST_CHECK_EQUAL(view.check({ flags::no_rules, 0, 0, 42 }), error::absolute_time_locked);
+    BOOST_CHECK_EQUAL(view.check({ flags::no_rules, 0, 0, 43 }), error::block_success);
+    BOOST_CHECK_EQUAL(view.check({ flags::no_rules, 0, 0, 42 }),
+        instance.check({ flags::no_rules, 0, 0, 42 }));
+}
+
+BOOST_AUTO_TEST_CASE(block_view__accept__legacy_sigops__expected)
+{
+    using namespace system;
+
+    // 1001 * multisig_default_sigops exceeds max_block_sigops.
+    const operations multisigs(1001, { opcode::checkmultisig });
+    const transaction heavy{ 1, { { { view_hash1, 0 }, script{}, 0 } },
+        { { 0, script{ multisigs } } }, 0 };
+    const block instance{ header{}, { view_coinbase, heavy } };
+    const auto view = to_view(instance);
+    BOOST_REQUIRE_GT(instance.signature_operations(false, false), max_block_sigops);
+    BOOST_CHECK_EQUAL(view.accept({ flags::no_rules, 0, 0, 1 }), error::block_sigop_limit);
+    BOOST_CHECK_EQUAL(view.accept({ flags::bip141_rule, 0, 0, 1 }), error::block_sigop_limit);
+
+    const block light{ header{}, { view_coinbase, spend(view_hash1, 0) } };
+    BOOST_CHECK_EQUAL(to_view(light).accept({ flags::bip141_rule, 0, 0, 1 }), error::block_success);
+}
+
 // TODO: add positive test for bip141.
 // TODO: add full malleation coverage since it is partially independent of
 // block implemention.
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(script_view_tests)
+
+using namespace system::chain;
+
+// Operations of the view match those of the deserialized script.
+static bool matches(const data_chunk& data) NOEXCEPT
+{
+    const script_view view{ data, false };
+    const script instance{ data, false };
+    const auto& ops = instance.ops();
+    if (view.op_count() != ops.size())
+        return false;
+
+    auto op = ops.begin();
+    for (const auto& item: view)
+    {
+        if (item.code != op->code() || item.underflow != op->is_underflow() ||
+            item.data != data_slice{ op->data() })
+            return false;
+
+        ++op;
+    }
+
+    return view.is_underflow() == (!ops.empty() && ops.back().is_underflow());
+}
+
+// construct
+
+BOOST_AUTO_TEST_CASE(script_view__construct__default__invalid_empty)
+{
+    const script_view view{};
+    BOOST_REQUIRE(!view.is_valid());
+    BOOST_REQUIRE(view.data().empty());
+    BOOST_REQUIRE(view.begin() == view.end());
+    BOOST_REQUIRE_EQUAL(view.op_count(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(script_view__construct__prefixed__expected)
+{
+    const auto data = base16_chunk("03" "51" "0142");
+    const script_view view{ data, true };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.op_count(), 2u);
+    BOOST_REQUIRE_EQUAL(view.to_data(true), data);
+    BOOST_REQUIRE_EQUAL(view.serialized_size(true), data.size());
+}
+
+BOOST_AUTO_TEST_CASE(script_view__construct__prefix_exceeds_data__invalid)
+{
+    const auto data = base16_chunk("04" "51" "0142");
+    const script_view view{ data, true };
+    BOOST_REQUIRE(!view.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(script_view__construct__script__expected)
+{
+    const script instance{ "dup hash160 [0000000000000000000000000000000000000000] equalverify checksig" };
+    const script_view view{ instance };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.data(), instance.to_data(false));
+    BOOST_REQUIRE(view.to_script() == instance);
+}
+
+BOOST_AUTO_TEST_CASE(script_view__construct__reader_arena__single_allocation)
+{
+    const auto data = base16_chunk("09" "0102" "0103" "4c0142" "ac" "51");
+    test::reporting_arena<false> arena{};
+    stream::in::fast stream(data);
+    read::bytes::fast source(stream, &arena);
+    const script_view view{ source, true };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.op_count(), 5u);
+    BOOST_REQUIRE_EQUAL(arena.inc_count, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_view__construct__unprefixed_reader_arena__single_allocation)
+{
+    const auto data = base16_chunk("0102" "0103" "4c0142" "ac" "51");
+    test::reporting_arena<false> arena{};
+    stream::in::fast stream(data);
+    read::bytes::fast source(stream, &arena);
+    const script_view view{ source, false };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.data(), data);
+    BOOST_REQUIRE_EQUAL(arena.inc_count, 1u);
+}
+
+// iteration
+
+BOOST_AUTO_TEST_CASE(script_view__iterate__pushes__expected)
+{
+    const auto data = base16_chunk("0102" "4c03aabbcc" "4d0100dd" "4e01000000ee" "00" "ac");
+    const script_view view{ data, false };
+    auto op = view.begin();
+    BOOST_REQUIRE(op->code == opcode::push_size_1);
+    BOOST_REQUIRE_EQUAL(op->data, base16_chunk("02"));
+    BOOST_REQUIRE((++op)->code == opcode::push_one_size);
+    BOOST_REQUIRE_EQUAL(op->data, base16_chunk("aabbcc"));
+    BOOST_REQUIRE((++op)->code == opcode::push_two_size);
+    BOOST_REQUIRE_EQUAL(op->data, base16_chunk("dd"));
+    BOOST_REQUIRE((++op)->code == opcode::push_four_size);
+    BOOST_REQUIRE_EQUAL(op->data, base16_chunk("ee"));
+    BOOST_REQUIRE((++op)->code == opcode::push_size_0);
+    BOOST_REQUIRE(op->data.empty());
+    BOOST_REQUIRE((++op)->code == opcode::checksig);
+    BOOST_REQUIRE(op->data.empty());
+    BOOST_REQUIRE(!op->underflow);
+    BOOST_REQUIRE(++op == view.end());
+    BOOST_REQUIRE(!view.is_underflow());
+}
+
+BOOST_AUTO_TEST_CASE(script_view__iterate__underflow__remainder)
+{
+    const auto data = base16_chunk("51" "4d0100");
+    const script_view view{ data, false };
+    auto op = view.begin();
+    BOOST_REQUIRE((++op)->underflow);
+    BOOST_REQUIRE_EQUAL(op->data, base16_chunk("4d0100"));
+    BOOST_REQUIRE(++op == view.end());
+    BOOST_REQUIRE(view.is_underflow());
+}
+
+BOOST_AUTO_TEST_CASE(script_view__iterate__operations__match_script)
+{
+    BOOST_REQUIRE(matches({}));
+    BOOST_REQUIRE(matches(base16_chunk("00")));
+    BOOST_REQUIRE(matches(base16_chunk("4c")));
+    BOOST_REQUIRE(matches(base16_chunk("4c00")));
+    BOOST_REQUIRE(matches(base16_chunk("4c01")));
+    BOOST_REQUIRE(matches(base16_chunk("4d01")));
+    BOOST_REQUIRE(matches(base16_chunk("4d010042")));
+    BOOST_REQUIRE(matches(base16_chunk("4e01000000")));
+    BOOST_REQUIRE(matches(base16_chunk("4effffffff42")));
+    BOOST_REQUIRE(matches(base16_chunk("02ab")));
+    BOOST_REQUIRE(matches(base16_chunk("76a914000000000000000000000000000000000000000088ac")));
+    BOOST_REQUIRE(matches(base16_chunk("5120" "0000000000000000000000000000000000000000000000000000000000000000")));
+    BOOST_REQUIRE(matches(base16_chunk("6a" "ff" "ba" "50" "0102")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -355,4 +355,49 @@ BOOST_AUTO_TEST_CASE(transaction_view__to_data__tx4_overloads__match_transaction
     BOOST_CHECK_EQUAL(to_chunk(stripped_stream.str()), tx.to_data(false));
 }
 
+// check and validation helpers
+
+BOOST_AUTO_TEST_CASE(transaction_view__check__test_block_transactions__match_transaction)
+{
+    using namespace system;
+    const chain::context ctx{ chain::flags::bip113_rule, 0, 0, 1 };
+
+    for (const auto& block: { test::genesis, test::block1, test::block9,
+        test::block2a, test::block2c })
+    {
+        const chain::block_view view{ block.to_data(true), true };
+        const auto& txs = *block.transactions_ptr();
+        BOOST_REQUIRE_EQUAL(view.views().size(), txs.size());
+
+        for (size_t index{}; index < txs.size(); ++index)
+        {
+            const auto& tx = *txs.at(index);
+            const auto& tx_view = view.views().at(index);
+            BOOST_CHECK_EQUAL(tx_view.is_coinbase_shaped(), tx.is_coinbase());
+            BOOST_CHECK_EQUAL(tx_view.check(), tx.check());
+            BOOST_CHECK_EQUAL(tx_view.check(ctx), tx.check(ctx));
+            BOOST_CHECK_EQUAL(tx_view.signature_operations(),
+                tx.signature_operations(false, false));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__signature_operations__underflow__excluded)
+{
+    using namespace system::chain;
+
+    // checksig, checkmultisig, then push_size_5 underflow of a checksig.
+    const script output_script{ base16_chunk("acae05ac"), false };
+    const transaction tx{ 1, { { { null_hash, 0 }, script{}, 0 } },
+        { { 0, output_script } }, 0 };
+
+    const auto data = tx.to_data(true);
+    stream::in::fast istream{ data };
+    read::bytes::fast reader{ istream };
+    const transaction_view view{ reader, data, false, true };
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_CHECK_EQUAL(view.signature_operations(), add1(multisig_default_sigops));
+    BOOST_CHECK_EQUAL(view.signature_operations(), tx.signature_operations(false, false));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -127,4 +127,99 @@ BOOST_AUTO_TEST_CASE(aes256__encrypt_ecb_decrypt_ecb__nist_7__expected)
     BOOST_REQUIRE_EQUAL(block, plain);
 }
 
+// Batch ECB.
+
+BOOST_AUTO_TEST_CASE(aes256__encrypt_ecb_decrypt_ecb__empty_blocks__empty)
+{
+    constexpr auto key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+    aes256::blocks blocks{};
+
+    aes256::encrypt_ecb(blocks, key);
+    BOOST_REQUIRE(blocks.empty());
+
+    aes256::decrypt_ecb(blocks, key);
+    BOOST_REQUIRE(blocks.empty());
+}
+
+BOOST_AUTO_TEST_CASE(aes256__encrypt_ecb_decrypt_ecb__nist_blocks__expected)
+{
+    // Five blocks covers one full interleave and one remaining block.
+    constexpr auto key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+    const aes256::blocks plain
+    {
+        base16_array("6bc1bee22e409f96e93d7e117393172a"),
+        base16_array("ae2d8a571e03ac9c9eb76fac45af8e51"),
+        base16_array("30c81c46a35ce411e5fbc1191a0a52ef"),
+        base16_array("f69f2445df4f9b17ad2b417be66c3710"),
+        base16_array("6bc1bee22e409f96e93d7e117393172a")
+    };
+    const aes256::blocks cipher
+    {
+        base16_array("f3eed1bdb5d2a03c064b5a7e3db181f8"),
+        base16_array("591ccb10d410ed26dc5ba74a31362870"),
+        base16_array("b6ed21b99ca6f4f9f153e7b1beafed1d"),
+        base16_array("23304b7a39f9f3ff067d8d8f9e24ecc7"),
+        base16_array("f3eed1bdb5d2a03c064b5a7e3db181f8")
+    };
+
+    auto blocks = plain;
+
+    aes256::encrypt_ecb(blocks, key);
+    BOOST_REQUIRE(blocks == cipher);
+
+    aes256::decrypt_ecb(blocks, key);
+    BOOST_REQUIRE(blocks == plain);
+}
+
+// Counter mode.
+// nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-38a.pdf (F.5.5)
+
+BOOST_AUTO_TEST_CASE(aes256__encrypt_ctr_decrypt_ctr__nist__expected)
+{
+    constexpr auto key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+    constexpr aes256::block counter = base16_array("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+    const auto plain = base16_chunk(
+        "6bc1bee22e409f96e93d7e117393172a"
+        "ae2d8a571e03ac9c9eb76fac45af8e51"
+        "30c81c46a35ce411e5fbc1191a0a52ef"
+        "f69f2445df4f9b17ad2b417be66c3710");
+    const auto cipher = base16_chunk(
+        "601ec313775789a5b7a7f504bbf3d228"
+        "f443e3ca4d62b59aca84e990cacaf5c5"
+        "2b0930daa23de94ce87017ba2d84988d"
+        "dfc9c58db67aada613c2dd08457941a6");
+
+    auto bytes = plain;
+
+    aes256::encrypt_ctr(bytes, counter, key);
+    BOOST_REQUIRE_EQUAL(bytes, cipher);
+
+    aes256::decrypt_ctr(bytes, counter, key);
+    BOOST_REQUIRE_EQUAL(bytes, plain);
+}
+
+BOOST_AUTO_TEST_CASE(aes256__encrypt_ctr__partial_block_counter_wrap__expected)
+{
+    // Counter wraps at 2^128 and final block is truncated.
+    constexpr auto key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+    constexpr aes256::block counter = base16_array("ffffffffffffffffffffffffffffffff");
+    constexpr aes256::block zero_counter{};
+    const data_chunk plain(20, 0x42);
+
+    aes256::block first{ counter };
+    aes256::block second{ zero_counter };
+    aes256::encrypt_ecb(first, key);
+    aes256::encrypt_ecb(second, key);
+
+    auto expected = plain;
+    for (size_t index{}; index < 16u; ++index)
+        expected[index] ^= first[index];
+    for (size_t index{}; index < 4u; ++index)
+        expected[16u + index] ^= second[index];
+
+    auto bytes = plain;
+    aes256::encrypt_ctr(bytes, counter, key);
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -386,6 +386,56 @@ BOOST_AUTO_TEST_CASE(secp256k1__schnorr_batch_verify__single_one_invalid__expect
     BOOST_REQUIRE_EQUAL(tokens.front(), from_little_array<batched::link_t>(correlates.at(1).id));
 }
 
+BOOST_AUTO_TEST_CASE(secp256k1__schnorr_batch_verify__multiple_invalid__expected)
+{
+    using namespace system;
+    using namespace system::schnorr;
+    using correlate = batch::correlate_t;
+    constexpr size_t count = 200;
+
+    ec_compressed pub{};
+    BOOST_REQUIRE(secret_to_public(pub, secret0));
+    const auto& point = array_cast<uint8_t, ec_xonly_size, 1>(pub);
+
+    std::vector<correlate> correlates(count);
+    std::vector<hash_digest> digests(count);
+    std::vector<ec_xonly> points(count, point);
+    std::vector<ec_signature> signatures(count);
+    constexpr hash_digest auxiliary{};
+
+    for (size_t row{}; row < count; ++row)
+    {
+        correlates.at(row) = correlate{ to_little_endian_size<3>(row) };
+        digests.at(row) = bitcoin_hash(to_little_endian(row));
+        BOOST_REQUIRE(sign(signatures.at(row), secret0, digests.at(row),
+            auxiliary));
+    }
+
+    // Failures spread across first, interior, adjacent and final rows.
+    const std::vector<size_t> invalid{ 0, 70, 71, 130, 199 };
+    for (const auto row: invalid)
+        signatures.at(row).front() ^= 0xff;
+
+    const batch in
+    {
+        { correlates.data(), correlates.size() },
+        { digests.data(), digests.size() },
+        { points.data(), points.size() },
+        { signatures.data(), signatures.size() }
+    };
+
+    const stopper cancel{};
+    const auto tokens = batch::verify(cancel, in);
+    BOOST_REQUIRE_EQUAL(tokens.size(), invalid.size());
+
+    for (size_t index{}; index < invalid.size(); ++index)
+    {
+        const auto& id = correlates.at(invalid.at(index)).id;
+        BOOST_REQUIRE(std::find(tokens.begin(), tokens.end(),
+            from_little_array<batched::link_t>(id)) != tokens.end());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BC_POP_WARNING()
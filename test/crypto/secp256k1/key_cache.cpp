@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(secp256k1_tests)
+
+using namespace system::key_cache;
+
+const ec_secret cache_secret = base16_array(
+    "8010b1bb119ad37d4b65a1022a314897b1b3614b345974332cb1b9582cf03536");
+
+BOOST_AUTO_TEST_CASE(key_cache__enabled__default__false)
+{
+    BOOST_REQUIRE(!enabled());
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 0u);
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(key_cache__enable__zero__disabled)
+{
+    enable(0);
+    BOOST_REQUIRE(!enabled());
+}
+
+BOOST_AUTO_TEST_CASE(key_cache__schnorr_verify__recurring_key__hit)
+{
+    const auto hash = bitcoin_hash(to_chunk("key-cache-schnorr"));
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, cache_secret));
+    const auto& x_point = array_cast<uint8_t, ec_xonly_size, 1>(point);
+
+    ec_signature signature{};
+    BOOST_REQUIRE(schnorr::sign(signature, cache_secret, hash, {}));
+
+    enable(100);
+    BOOST_REQUIRE(enabled());
+    BOOST_REQUIRE(schnorr::verify_signature(x_point, hash, signature));
+    BOOST_REQUIRE(schnorr::verify_signature(x_point, hash, signature));
+    BOOST_REQUIRE(schnorr::verify_signature(x_point, hash, signature));
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 1u);
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 2u);
+
+    disable();
+    BOOST_REQUIRE(!enabled());
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(key_cache__ecdsa_verify__recurring_key__hit)
+{
+    const auto hash = bitcoin_hash(to_chunk("key-cache-ecdsa"));
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, cache_secret));
+
+    ec_signature signature{};
+    BOOST_REQUIRE(ecdsa::sign(signature, cache_secret, hash));
+
+    enable(100);
+    BOOST_REQUIRE(ecdsa::verify_signature(point, hash, signature));
+    BOOST_REQUIRE(ecdsa::verify_signature(point, hash, signature));
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 1u);
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 1u);
+    disable();
+}
+
+BOOST_AUTO_TEST_CASE(key_cache__schnorr_verify__evicted_keys__expected)
+{
+    constexpr size_t keys = 20;
+    const auto hash = bitcoin_hash(to_chunk("key-cache-evict"));
+
+    std::vector<ec_xonly> points(keys);
+    std::vector<ec_signature> signatures(keys);
+    for (size_t key{}; key < keys; ++key)
+    {
+        auto secret = cache_secret;
+        secret.back() = narrow_cast<uint8_t>(key);
+
+        ec_compressed point{};
+        BOOST_REQUIRE(secret_to_public(point, secret));
+        points.at(key) = array_cast<uint8_t, ec_xonly_size, 1>(point);
+        BOOST_REQUIRE(schnorr::sign(signatures.at(key), secret, hash, {}));
+    }
+
+    // Capacity of one set, so most keys are evicted between uses.
+    enable(1);
+    for (size_t round{}; round < 2u; ++round)
+        for (size_t key{}; key < keys; ++key)
+            BOOST_REQUIRE(schnorr::verify_signature(points.at(key), hash,
+                signatures.at(key)));
+
+    const auto statistics = get_statistics();
+    BOOST_REQUIRE_EQUAL(statistics.hits + statistics.misses, 2u * keys);
+    BOOST_REQUIRE_GE(statistics.misses, keys);
+    disable();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(signature_cache_tests)
+
+using namespace system::signature_cache;
+
+constexpr auto point = base16_array(
+    "0309ba8621aefd3b6ba4ca6d11a4746e8df8d35d9b51b383338f627ba7fc732731");
+constexpr auto xonly = base16_array(
+    "09ba8621aefd3b6ba4ca6d11a4746e8df8d35d9b51b383338f627ba7fc732731");
+constexpr auto hash = base16_array(
+    "ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f");
+constexpr ec_signature signature = base16_array(
+    "4832febef8b31c7c922a15cb4063a43ab69b099bba765e24facef50dfbb4d057"
+    "928ed5c6b6886562c2fe6972fd7c7f462e557129067542cce6b37d72e5ea5037");
+
+BOOST_AUTO_TEST_CASE(signature_cache__enabled__default__false)
+{
+    BOOST_REQUIRE(!enabled());
+    put_ecdsa(point, hash, signature);
+    BOOST_REQUIRE(!has_ecdsa(point, hash, signature));
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 0u);
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__enable__zero__disabled)
+{
+    enable(0);
+    BOOST_REQUIRE(!enabled());
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__has_ecdsa__put__true)
+{
+    enable(100);
+    BOOST_REQUIRE(enabled());
+    BOOST_REQUIRE(!has_ecdsa(point, hash, signature));
+    put_ecdsa(point, hash, signature);
+    BOOST_REQUIRE(has_ecdsa(point, hash, signature));
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 1u);
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 1u);
+
+    disable();
+    BOOST_REQUIRE(!enabled());
+    BOOST_REQUIRE(!has_ecdsa(point, hash, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__has_schnorr__put__true)
+{
+    enable(100);
+    put_schnorr(xonly, hash, signature);
+    BOOST_REQUIRE(has_schnorr(xonly, hash, signature));
+    disable();
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__has__distinct_triple__false)
+{
+    enable(100);
+    put_ecdsa(point, hash, signature);
+
+    auto other_hash = hash;
+    other_hash.front() ^= 0x01;
+    auto other_signature = signature;
+    other_signature.back() ^= 0x01;
+    auto other_point = point;
+    other_point.front() = ec_even_sign;
+
+    BOOST_REQUIRE(!has_ecdsa(point, other_hash, signature));
+    BOOST_REQUIRE(!has_ecdsa(point, hash, other_signature));
+    BOOST_REQUIRE(!has_ecdsa(other_point, hash, signature));
+    disable();
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__has_schnorr__ecdsa_put__false)
+{
+    enable(100);
+    put_ecdsa(xonly, hash, signature);
+    BOOST_REQUIRE(!has_schnorr(xonly, hash, signature));
+    disable();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(flat_hash_set_tests)
+
+using hash_set = flat_hash_set<hash_digest, unique_hash_t<>>;
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__construct__default__empty)
+{
+    const hash_set set{};
+    BOOST_REQUIRE(set.empty());
+    BOOST_REQUIRE_EQUAL(set.size(), 0u);
+    BOOST_REQUIRE(!set.contains(null_hash));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__emplace__duplicate__false)
+{
+    const auto first = null_hash;
+    const auto second = null_hash;
+    hash_set set{ 1 };
+    BOOST_REQUIRE(set.emplace(first));
+    BOOST_REQUIRE(!set.emplace(second));
+    BOOST_REQUIRE(!set.emplace(first));
+    BOOST_REQUIRE_EQUAL(set.size(), 1u);
+    BOOST_REQUIRE(set.contains(second));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__emplace__beyond_reserve__grows)
+{
+    // Keys share low order bytes (equal unique_hash), forcing long probes.
+    std_vector<hash_digest> keys(100, null_hash);
+    for (size_t index{}; index < keys.size(); ++index)
+        keys[index].back() = narrow_cast<uint8_t>(index);
+
+    hash_set set{};
+    for (const auto& key: keys)
+        BOOST_REQUIRE(set.emplace(key));
+
+    BOOST_REQUIRE_EQUAL(set.size(), keys.size());
+    for (const auto& key: keys)
+        BOOST_REQUIRE(set.contains(key));
+
+    BOOST_REQUIRE(!set.contains(one_hash));
+}
+
+BOOST_AUTO_TEST_CASE(flat_hash_set__clear__populated__empty)
+{
+    const auto key = one_hash;
+    hash_set set{ 1 };
+    BOOST_REQUIRE(set.emplace(key));
+    set.clear();
+    BOOST_REQUIRE(set.empty());
+    BOOST_REQUIRE(!set.contains(key));
+    BOOST_REQUIRE(set.emplace(key));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
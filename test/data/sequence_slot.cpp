@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(sequence_slot_tests)
+
+using slot = sequence_slot<3>;
+
+BOOST_AUTO_TEST_CASE(sequence_slot__construct__default__empty_unreadable)
+{
+    const slot instance{};
+    slot::words out{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.read(out));
+}
+
+BOOST_AUTO_TEST_CASE(sequence_slot__write__read__expected)
+{
+    slot instance{};
+    constexpr slot::words value{ 1, 2, 3 };
+    BOOST_REQUIRE(instance.write(value));
+    BOOST_REQUIRE(!instance.empty());
+
+    slot::words out{};
+    BOOST_REQUIRE(instance.read(out));
+    BOOST_REQUIRE(out == value);
+}
+
+BOOST_AUTO_TEST_CASE(sequence_slot__write__overwrite__expected)
+{
+    slot instance{};
+    constexpr slot::words value{ 4, 5, 6 };
+    BOOST_REQUIRE(instance.write({ 1, 2, 3 }));
+    BOOST_REQUIRE(instance.write(value));
+
+    slot::words out{};
+    BOOST_REQUIRE(instance.read(out));
+    BOOST_REQUIRE(out == value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,4 +26,65 @@ BOOST_AUTO_TEST_CASE(golomb_test)
     BOOST_REQUIRE(true);
 }
 
+constexpr uint8_t golomb_bits = 19;
+constexpr uint64_t golomb_rate = 784931;
+constexpr siphash_key golomb_key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+// Distinct items of varying size, enough to exercise the radix sort.
+static data_stack golomb_items(size_t count, uint8_t seed) NOEXCEPT
+{
+    data_stack items{};
+    for (size_t index{}; index < count; ++index)
+    {
+        data_chunk item(4u + index % 40u, seed);
+        const auto bytes = to_little_endian(narrow_cast<uint32_t>(index));
+        std::copy(bytes.begin(), bytes.end(), item.begin());
+        items.push_back(std::move(item));
+    }
+
+    return items;
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_many__members__true)
+{
+    const auto items = golomb_items(1000, 0x42);
+    const auto set = golomb::construct(items, golomb_bits, golomb_key,
+        golomb_rate);
+
+    for (const auto& item: items)
+    {
+        BOOST_REQUIRE(golomb::match_single(set, item, items.size(),
+            golomb_key, golomb_bits, golomb_rate));
+        BOOST_REQUIRE(golomb::match_many(set, { item }, items.size(),
+            golomb_key, golomb_bits, golomb_rate));
+    }
+
+    BOOST_REQUIRE(golomb::match_many(set, items, items.size(),
+        golomb_key, golomb_bits, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_many__non_members__false)
+{
+    const auto items = golomb_items(1000, 0x42);
+    const auto others = golomb_items(500, 0x24);
+    const auto set = golomb::construct(items, golomb_bits, golomb_key,
+        golomb_rate);
+
+    BOOST_REQUIRE(!golomb::match_many(set, {}, items.size(),
+        golomb_key, golomb_bits, golomb_rate));
+    BOOST_REQUIRE_EQUAL(golomb::match_many(set, others, items.size(),
+        golomb_key, golomb_bits, golomb_rate),
+        golomb::match_stack(set, others, items.size(),
+        golomb_key, golomb_bits, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_many__exhausted_set__false)
+{
+    const auto items = golomb_items(1, 0x42);
+    BOOST_REQUIRE(!golomb::match_many(data_chunk{}, items, 1,
+        golomb_key, golomb_bits, golomb_rate));
+    BOOST_REQUIRE(!golomb::match_many(data_chunk{ 0xff, 0xff }, items, 1,
+        golomb_key, golomb_bits, golomb_rate));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -359,4 +359,89 @@ BOOST_AUTO_TEST_CASE(checksum__bech32_verify_checked__invalid_checksum__false)
     BOOST_REQUIRE(!bech32_verify_checked(out_version, out_program, bip173_testnet_prefix, checked));
 }
 
+// bech32_encode_many/bech32_decode_many
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode_many__bip173__expected)
+{
+    const data_chunk versions{ bip173_program_version, bip173_program_version };
+    const data_stack programs{ bip173_p2wkh_program(), bip173_p2wsh_program() };
+    const auto mainnet = bech32_encode_many(bip173_mainnet_prefix, versions, programs);
+    BOOST_REQUIRE_EQUAL(mainnet.size(), 2u);
+    BOOST_REQUIRE_EQUAL(mainnet[0], "bc1" + std::string{ bip173_mainnet_p2wkh });
+    BOOST_REQUIRE_EQUAL(mainnet[1], "bc1" + std::string{ bip173_mainnet_p2wsh });
+
+    const auto testnet = bech32_encode_many("TB", versions, programs);
+    BOOST_REQUIRE_EQUAL(testnet.size(), 2u);
+    BOOST_REQUIRE_EQUAL(testnet[0], "tb1" + std::string{ bip173_testnet_p2wkh });
+    BOOST_REQUIRE_EQUAL(testnet[1], "tb1" + std::string{ bip173_testnet_p2wsh });
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode_many__build_checked_equivalence__expected)
+{
+    data_chunk versions;
+    data_stack programs;
+    for (uint8_t version = 0; version <= 16; ++version)
+    {
+        versions.push_back(version);
+        programs.emplace_back(add1(version) * 2u, version);
+    }
+
+    const auto addresses = bech32_encode_many("bcrt", versions, programs);
+    BOOST_REQUIRE_EQUAL(addresses.size(), versions.size());
+    for (size_t index = 0; index < versions.size(); ++index)
+    {
+        const auto checked = bech32_build_checked(versions[index], programs[index], "bcrt");
+        BOOST_REQUIRE_EQUAL(addresses[index], "bcrt1" + encode_base32(checked));
+    }
+
+    data_chunk decoded_versions;
+    data_stack decoded_programs;
+    BOOST_REQUIRE(bech32_decode_many(decoded_versions, decoded_programs, "bcrt", addresses));
+    BOOST_REQUIRE_EQUAL(decoded_versions, versions);
+    BOOST_REQUIRE(decoded_programs == programs);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode_many__version_overflow__empty_element)
+{
+    const auto addresses = bech32_encode_many("bc", { 32, 0 }, { {}, {} });
+    BOOST_REQUIRE_EQUAL(addresses.size(), 2u);
+    BOOST_REQUIRE(addresses[0].empty());
+    BOOST_REQUIRE(!addresses[1].empty());
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode_many__mismatched_sizes__empty)
+{
+    BOOST_REQUIRE(bech32_encode_many("bc", { 0, 0 }, { {} }).empty());
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode_many__upper_case__true_expected)
+{
+    data_chunk versions;
+    data_stack programs;
+    const string_list addresses{ ascii_to_upper("bc1" + std::string{ bip173_mainnet_p2wkh }) };
+    BOOST_REQUIRE(bech32_decode_many(versions, programs, bip173_mainnet_prefix, addresses));
+    BOOST_REQUIRE_EQUAL(versions, data_chunk{ bip173_program_version });
+    BOOST_REQUIRE_EQUAL(programs.size(), 1u);
+    BOOST_REQUIRE_EQUAL(programs[0], bip173_p2wkh_program());
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode_many__any_invalid__false_cleared)
+{
+    data_chunk versions;
+    data_stack programs;
+    const auto valid = "bc1" + std::string{ bip173_mainnet_p2wkh };
+    const auto mixed = "BC1" + std::string{ bip173_mainnet_p2wkh };
+    const auto testnet = "tb1" + std::string{ bip173_testnet_p2wkh };
+    auto corrupt = valid;
+    corrupt.back() = 'q';
+
+    BOOST_REQUIRE(!bech32_decode_many(versions, programs, "bc", { valid, mixed }));
+    BOOST_REQUIRE(versions.empty());
+    BOOST_REQUIRE(programs.empty());
+    BOOST_REQUIRE(!bech32_decode_many(versions, programs, "bc", { valid, testnet }));
+    BOOST_REQUIRE(!bech32_decode_many(versions, programs, "bc", { valid, corrupt }));
+    BOOST_REQUIRE(!bech32_decode_many(versions, programs, "bc", { valid, "bc1" }));
+    BOOST_REQUIRE(!bech32_decode_many(versions, programs, "bc", { valid, "bcx" + valid.substr(3) }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
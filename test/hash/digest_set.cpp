@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(digest_set_tests)
+
+// Digests are expected to be uniform, as are sha256 outputs.
+static hash_digest digest_at(size_t index) NOEXCEPT
+{
+    return sha256_hash(to_little_endian(index));
+}
+
+BOOST_AUTO_TEST_CASE(digest_set__capacity__entries__rounded_up_buckets)
+{
+    BOOST_REQUIRE_EQUAL(digest_set{ 0 }.capacity(), 4u);
+    BOOST_REQUIRE_EQUAL(digest_set{ 1 }.capacity(), 4u);
+    BOOST_REQUIRE_EQUAL(digest_set{ 5 }.capacity(), 8u);
+    BOOST_REQUIRE_EQUAL(digest_set{ 100 }.capacity(), 128u);
+}
+
+BOOST_AUTO_TEST_CASE(digest_set__contains__empty__false)
+{
+    digest_set instance{ 100 };
+    BOOST_REQUIRE(!instance.contains(digest_at(0)));
+    BOOST_REQUIRE(!instance.contains(null_hash));
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().hits, 0u);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().misses, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(digest_set__contains__inserted__true)
+{
+    digest_set instance{ 100 };
+    instance.insert(digest_at(0));
+    instance.insert(digest_at(0));
+    instance.insert(digest_at(1));
+    BOOST_REQUIRE(instance.contains(digest_at(0)));
+    BOOST_REQUIRE(instance.contains(digest_at(1)));
+    BOOST_REQUIRE(!instance.contains(digest_at(2)));
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().hits, 2u);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().misses, 1u);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().capacity, 128u);
+}
+
+BOOST_AUTO_TEST_CASE(digest_set__contains__under_capacity__all_retained)
+{
+    constexpr size_t count = 64;
+    digest_set instance{ 4 * count };
+    for (size_t index{}; index < count; ++index)
+        instance.insert(digest_at(index));
+
+    for (size_t index{}; index < count; ++index)
+        BOOST_REQUIRE(instance.contains(digest_at(index)));
+}
+
+BOOST_AUTO_TEST_CASE(digest_set__contains__over_capacity__bounded)
+{
+    constexpr size_t count = 1000;
+    digest_set instance{ 64 };
+    for (size_t index{}; index < count; ++index)
+        instance.insert(digest_at(index));
+
+    // Most recent entry retained, most early entries displaced.
+    BOOST_REQUIRE(instance.contains(digest_at(sub1(count))));
+
+    size_t found{};
+    for (size_t index{}; index < count; ++index)
+        found += to_int(instance.contains(digest_at(index)));
+
+    BOOST_REQUIRE_LE(found, instance.capacity());
+    BOOST_REQUIRE_GT(found, instance.capacity() / 2u);
+}
+
+// salted_digest_set
+
+BOOST_AUTO_TEST_CASE(salted_digest_set__construct__default__disabled)
+{
+    salted_digest_set instance{};
+    instance.insert(digest_at(0));
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE(!instance.contains(digest_at(0)));
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().misses, 0u);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().capacity, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(salted_digest_set__enable__zero__disabled)
+{
+    salted_digest_set instance{};
+    instance.enable(0);
+    BOOST_REQUIRE(!instance.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(salted_digest_set__contains__inserted__true)
+{
+    salted_digest_set instance{};
+    instance.enable(100);
+    BOOST_REQUIRE(instance.enabled());
+    instance.insert(digest_at(0));
+    BOOST_REQUIRE(instance.contains(digest_at(0)));
+    BOOST_REQUIRE(!instance.contains(digest_at(1)));
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().hits, 1u);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().misses, 1u);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().capacity, 128u);
+}
+
+BOOST_AUTO_TEST_CASE(salted_digest_set__disable__inserted__cleared)
+{
+    salted_digest_set instance{};
+    instance.enable(100);
+    instance.insert(digest_at(0));
+    instance.disable();
+    BOOST_REQUIRE(!instance.contains(digest_at(0)));
+    instance.enable(100);
+    BOOST_REQUIRE(!instance.contains(digest_at(0)));
+}
+
+BOOST_AUTO_TEST_CASE(salted_digest_set__context__reenabled__resalted)
+{
+    salted_digest_set instance{};
+    instance.enable(100);
+    auto context1 = instance.context();
+    instance.enable(100);
+    auto context2 = instance.context();
+    BOOST_REQUIRE_NE(context1.flush(), context2.flush());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -295,6 +295,26 @@ BOOST_AUTO_TEST_CASE(functions__bitcoin_short__null_one__expected)
     BOOST_CHECK_EQUAL(bitcoin_short_chunk(to_chunk(null_hash)), to_chunk(expected));
 }
 
+BOOST_AUTO_TEST_CASE(functions__bitcoin_short_hashes__empty__empty)
+{
+    BOOST_REQUIRE(bitcoin_short_hashes({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(functions__bitcoin_short_hashes__mixed_sizes__expected)
+{
+    data_stack set{};
+    for (uint8_t size = 0; size < 42; ++size)
+        set.emplace_back(size, size);
+
+    const auto hashes = bitcoin_short_hashes(set);
+    BOOST_REQUIRE_EQUAL(hashes.size(), set.size());
+
+    for (size_t index = 0; index < set.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index], bitcoin_short_hash(set[index]));
+    }
+}
+
 // bitcoin_hash
 // ----------------------------------------------------------------------------
 
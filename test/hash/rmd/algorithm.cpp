@@ -67,6 +67,65 @@ BOOST_AUTO_TEST_CASE(rmd__rmd160_hash__test_vectors__expected)
     }
 }
 
+// batch (vectorized halves)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(rmd__rmd128_hash__halves_empty__empty)
+{
+    BOOST_REQUIRE(rmd128::hash(rmd128::halves_t{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd128_hash__halves__expected)
+{
+    // 37 spans all lanes (16/8/4) and a normal form remainder.
+    rmd128::halves_t halves(37);
+    for (size_t half = 0; half < halves.size(); ++half)
+        for (size_t byte = 0; byte < array_count<rmd128::half_t>; ++byte)
+            halves[half][byte] = narrow_cast<uint8_t>(half * 31u + byte);
+
+    const auto digests = rmd128::hash(halves);
+    BOOST_REQUIRE_EQUAL(digests.size(), halves.size());
+
+    for (size_t half = 0; half < halves.size(); ++half)
+    {
+        BOOST_REQUIRE_EQUAL(digests[half], rmd128::hash(halves[half]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hash__halves_empty__empty)
+{
+    BOOST_REQUIRE(rmd160::hash(rmd160::halves_t{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hash__null_halves__expected)
+{
+    const rmd160::halves_t halves(17);
+    const auto digests = rmd160::hash(halves);
+    BOOST_REQUIRE_EQUAL(digests.size(), halves.size());
+
+    for (const auto& digest: digests)
+    {
+        BOOST_REQUIRE_EQUAL(digest, rmd_half160);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hash__halves__expected)
+{
+    // 37 spans all lanes (16/8/4) and a normal form remainder.
+    rmd160::halves_t halves(37);
+    for (size_t half = 0; half < halves.size(); ++half)
+        for (size_t byte = 0; byte < array_count<rmd160::half_t>; ++byte)
+            halves[half][byte] = narrow_cast<uint8_t>(half * 31u + byte);
+
+    const auto digests = rmd160::hash(halves);
+    BOOST_REQUIRE_EQUAL(digests.size(), halves.size());
+
+    for (size_t half = 0; half < halves.size(); ++half)
+    {
+        BOOST_REQUIRE_EQUAL(digests[half], rmd160::hash(halves[half]));
+    }
+}
+
 // Verify types.
 // ----------------------------------------------------------------------------
 
@@ -213,6 +272,8 @@ static_assert(is_same_type<rmd160::words_t, std_array<uint32_t, 16>>);
 static_assert(is_same_type<rmd160::block_t, std_array<uint8_t, 64>>);
 static_assert(is_same_type<rmd160::half_t, std_array<uint8_t, 32>>);
 static_assert(is_same_type<rmd160::digest_t, std_array<uint8_t, 20>>);
+static_assert(is_same_type<rmd160::halves_t, std::vector<std_array<uint8_t, 32>>>);
+static_assert(is_same_type<rmd160::digests_t, std::vector<std_array<uint8_t, 20>>>);
 static_assert(is_same_type<rmd160::count_t, uint64_t>);
 static_assert(is_same_type<decltype(rmd160::limit_bits), const uint64_t>);
 static_assert(is_same_type<decltype(rmd160::limit_bytes), const uint64_t>);
@@ -279,6 +279,61 @@ BOOST_AUTO_TEST_CASE(sha256__double_hash__half_blocks__expected)
     BOOST_CHECK_EQUAL(sha256::double_hash({ 0 }, { 1 }), expected);
 }
 
+// sha256::hash(messages)
+BOOST_AUTO_TEST_CASE(sha256__hash_messages__empty__empty)
+{
+    BOOST_CHECK(sha256::hash(sha256::messages_t{}).empty());
+    BOOST_CHECK(sha256::double_hash(sha256::messages_t{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(sha256__hash_messages__test_vectors__expected)
+{
+    sha256::messages_t messages{};
+    for (const auto& test: sha256_256_tests)
+        messages.push_back({ test.data });
+
+    const auto digests = sha256::hash(messages);
+    BOOST_REQUIRE_EQUAL(digests.size(), sha256_256_tests.size());
+
+    auto digest = digests.begin();
+    for (const auto& test: sha256_256_tests)
+        BOOST_REQUIRE_EQUAL(*digest++, test.expected);
+}
+
+BOOST_AUTO_TEST_CASE(sha256__hash_messages__varied_split_messages__expected)
+{
+    // Lengths span the one/two block padding boundary and multiple blocks,
+    // with enough messages to fill (and remain from) the widest lanes.
+    std::vector<data_chunk> data{};
+    for (size_t size{}; size < 200; size += 3)
+        data.emplace_back(size, narrow_cast<uint8_t>(size));
+
+    sha256::messages_t messages{};
+    for (const auto& chunk: data)
+    {
+        const auto first = to_half(chunk.size());
+        const auto second = first + to_half(chunk.size() - first);
+        const auto begin = chunk.data();
+        messages.push_back(
+        {
+            data_slice{ begin, std::next(begin, first) },
+            data_slice{ std::next(begin, first), std::next(begin, second) },
+            data_slice{ std::next(begin, second), std::next(begin, chunk.size()) }
+        });
+    }
+
+    const auto single = sha256::hash(messages);
+    const auto twice = sha256::double_hash(messages);
+    BOOST_REQUIRE_EQUAL(single.size(), data.size());
+    BOOST_REQUIRE_EQUAL(twice.size(), data.size());
+
+    for (size_t index{}; index < data.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(single[index], sha256_hash(data[index]));
+        BOOST_REQUIRE_EQUAL(twice[index], bitcoin_hash(data[index]));
+    }
+}
+
 // sha256::merkle_hash
 BOOST_AUTO_TEST_CASE(sha256__merkle_hash__two__expected)
 {
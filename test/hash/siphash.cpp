@@ -74,4 +74,30 @@ BOOST_AUTO_TEST_CASE(siphash__key__vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(siphash__messages__vectors__expected)
+{
+    half_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, hash_test_key));
+
+    data_stack messages{};
+    std::vector<uint64_t> expected{};
+    for (const auto& result: siphash_hash_tests)
+    {
+        data_chunk data;
+        BOOST_REQUIRE(decode_base16(data, result.message));
+        messages.push_back(data);
+
+        data_chunk encoded_expected;
+        BOOST_REQUIRE(decode_base16(encoded_expected, result.result));
+        expected.push_back(from_little_endian<uint64_t>(encoded_expected));
+    }
+
+    BOOST_REQUIRE_EQUAL(siphash(to_siphash_key(hash), messages), expected);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__messages__empty__empty)
+{
+    BOOST_REQUIRE(siphash(siphash_key{}, data_stack{}).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -276,4 +276,105 @@ BOOST_AUTO_TEST_CASE(interpreter__run__tapscript_codeseparator_signature_hash__s
     BOOST_REQUIRE_EQUAL(run_tapscript(leaf, elements), error::script_success);
 }
 
+// Dispatch.
+// ----------------------------------------------------------------------------
+
+namespace {
+
+template <bool Threaded>
+code run_input_script(const script& input_script) NOEXCEPT
+{
+    using stack = contiguous_stack;
+    const point outpoint{ one_hash, 0u };
+    const chain::inputs ins{ input{ outpoint, input_script, witness{}, 0xffffffff } };
+    const transaction tx{ 1u, ins, chain::outputs{}, 0u };
+    const auto in = tx.inputs_ptr()->begin();
+
+    interpreter<stack, program<stack>, Threaded> program{ tx, in, flags::no_rules, {} };
+    return program.run();
+}
+
+// Threaded and switch dispatch must both produce the expected result.
+bool is_dispatched(const script& input_script, const code& expected) NOEXCEPT
+{
+    return run_input_script<true>(input_script) == expected &&
+        run_input_script<false>(input_script) == expected;
+}
+
+// <value> OP_IF <ops> OP_ENDIF OP_1
+script to_conditional_script(bool value, const operations& ops) NOEXCEPT
+{
+    operations out{};
+    out.emplace_back(value ? opcode::push_positive_1 : opcode::push_size_0);
+    out.emplace_back(opcode::if_);
+    out.insert(out.end(), ops.begin(), ops.end());
+    out.emplace_back(opcode::endif);
+    out.emplace_back(opcode::push_positive_1);
+    return script{ std::move(out) };
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_else__success)
+{
+    const script instance{ "1 if 2 else return endif" };
+    BOOST_REQUIRE(is_dispatched(instance, error::script_success));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_nested_unexecuted__success)
+{
+    const script instance{ "0 if 0 if return else return endif return else 0 notif 1 endif endif" };
+    BOOST_REQUIRE(is_dispatched(instance, error::script_success));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_repeated_else__success)
+{
+    const script instance{ "1 if else else 2 endif" };
+    BOOST_REQUIRE(is_dispatched(instance, error::script_success));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_executed_failure__op_verify2)
+{
+    const script instance{ "1 verify 0 verify 1" };
+    BOOST_REQUIRE(is_dispatched(instance, error::op_verify2));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_unbalanced__invalid_stack_scope)
+{
+    const script instance{ "0 if return" };
+    BOOST_REQUIRE(is_dispatched(instance, error::invalid_stack_scope));
+}
+
+// Operations in an unexecuted branch are counted (as are if and endif).
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_unexecuted_counted_at_limit__success)
+{
+    const operations nops(max_counted_ops - 2u, operation{ opcode::nop });
+    BOOST_REQUIRE(is_dispatched(to_conditional_script(false, nops), error::script_success));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_unexecuted_counted_exceeded__invalid_operation_count)
+{
+    const operations nops(sub1(max_counted_ops), operation{ opcode::nop });
+    BOOST_REQUIRE(is_dispatched(to_conditional_script(false, nops), error::invalid_operation_count));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_executed_counted_exceeded__invalid_operation_count)
+{
+    const operations nops(sub1(max_counted_ops), operation{ opcode::nop });
+    BOOST_REQUIRE(is_dispatched(to_conditional_script(true, nops), error::invalid_operation_count));
+}
+
+// Oversized pushes fail in an unexecuted branch, following any skipped ops.
+BOOST_AUTO_TEST_CASE(interpreter__run__dispatch_unexecuted_oversized__invalid_push_data_size)
+{
+    const operations ops
+    {
+        operation{ opcode::nop },
+        operation{ data_chunk(add1(max_push_data_size), 0x42), false },
+        operation{ opcode::nop }
+    };
+
+    BOOST_REQUIRE(is_dispatched(to_conditional_script(false, ops), error::invalid_push_data_size));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
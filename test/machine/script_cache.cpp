@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(script_cache_tests)
+
+using namespace system::machine::script_cache;
+
+constexpr auto wtxid = base16_array(
+    "ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f");
+constexpr uint32_t flags = 0x0001ffff;
+
+BOOST_AUTO_TEST_CASE(script_cache__enabled__default__false)
+{
+    BOOST_REQUIRE(!enabled());
+    put(wtxid, 0, flags);
+    BOOST_REQUIRE(!has(wtxid, 0, flags));
+    BOOST_REQUIRE_EQUAL(get_statistics().capacity, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__enable__entries__capacity)
+{
+    enable(100);
+    BOOST_REQUIRE(enabled());
+    BOOST_REQUIRE_GE(get_statistics().capacity, 100u);
+
+    enable(0);
+    BOOST_REQUIRE(!enabled());
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__has__put__true)
+{
+    enable(100);
+    BOOST_REQUIRE(!has(wtxid, 1, flags));
+    put(wtxid, 1, flags);
+    BOOST_REQUIRE(has(wtxid, 1, flags));
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 1u);
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 1u);
+
+    disable();
+    BOOST_REQUIRE(!has(wtxid, 1, flags));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__has__distinct_input_or_flags__false)
+{
+    enable(100);
+    put(wtxid, 1, flags);
+
+    auto other = wtxid;
+    other.back() ^= 0x01;
+    BOOST_REQUIRE(!has(other, 1, flags));
+    BOOST_REQUIRE(!has(wtxid, 0, flags));
+    BOOST_REQUIRE(!has(wtxid, 1, sub1(flags)));
+    disable();
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__connect__repeated__cached)
+{
+    using namespace system::chain;
+    using namespace system::machine;
+    const transaction tx
+    {
+        1, inputs{ { { null_hash, 0 }, {}, 0 }, { { null_hash, 1 }, {}, 0 } }, {}, 0
+    };
+
+    // Output script that succeeds given an empty input script.
+    const auto& ins = *tx.inputs_ptr();
+    ins.front()->prevout = to_shared<output>(0, script{ { opcode::push_positive_1 } });
+    ins.back()->prevout = to_shared<output>(0, script{ { opcode::push_size_0 } });
+
+    enable(100);
+    const context state{};
+    BOOST_REQUIRE(!interpreter<linked_stack>::connect(state, tx, 0));
+    BOOST_REQUIRE(!interpreter<linked_stack>::connect(state, tx, 0));
+    BOOST_REQUIRE(has(tx.hash(true), 0, state.flags));
+    BOOST_REQUIRE_EQUAL(get_statistics().hits, 2u);
+    BOOST_REQUIRE_EQUAL(get_statistics().misses, 1u);
+
+    // Failures are not cached.
+    BOOST_REQUIRE_EQUAL(interpreter<linked_stack>::connect(state, tx, 1), error::stack_false);
+    BOOST_REQUIRE_EQUAL(interpreter<linked_stack>::connect(state, tx, 1), error::stack_false);
+    BOOST_REQUIRE(!has(tx.hash(true), 1, state.flags));
+    disable();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
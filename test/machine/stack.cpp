@@ -20,10 +20,11 @@
 
 using namespace system::machine;
 
-static_assert(std::variant_size<stack_variant>::value == 3u);
+static_assert(std::variant_size<stack_variant>::value == 4u);
 static_assert(is_same_type<std::variant_alternative_t<stack_type::bool_, stack_variant>, bool>);
 static_assert(is_same_type<std::variant_alternative_t<stack_type::int64_, stack_variant>, int64_t>);
 static_assert(is_same_type<std::variant_alternative_t<stack_type::pchunk_, stack_variant>, chunk_xptr>);
+static_assert(is_same_type<std::variant_alternative_t<stack_type::ichunk_, stack_variant>, stack_chunk>);
 
 BOOST_AUTO_TEST_SUITE(stack_tests)
 
@@ -52,4 +53,63 @@ BOOST_AUTO_TEST_CASE(stack__pop__pushed_chunk__expected)
     BOOST_REQUIRE(stack.pop() == stack_variant{ ptr });
 }
 
+BOOST_AUTO_TEST_CASE(stack__pop__arena_pushed_chunk__expected)
+{
+    const auto expected = data_chunk{ 0x42, 0x43, 0x44, 0x45, 0x46 };
+    const chunk_xptr ptr{ expected };
+    stack<arena_stack> stack{};
+    stack.push(data_chunk{ 0x42, 0x43, 0x44, 0x45, 0x46 });
+    BOOST_REQUIRE(stack.pop() == stack_variant{ ptr });
+}
+
+BOOST_AUTO_TEST_CASE(stack__swap__arena_stack__expected)
+{
+    stack<arena_stack> stack{};
+    stack.push(true);
+    stack.push(42);
+    stack.swap(0, 1);
+    BOOST_REQUIRE(stack.pop() == stack_variant{ true });
+    BOOST_REQUIRE(stack.pop() == stack_variant{ 42 });
+    BOOST_REQUIRE(stack.empty());
+}
+
+BOOST_AUTO_TEST_CASE(stack__pop__emplaced_inline__expected)
+{
+    const stack_chunk expected{ short_hash{ 0x42 } };
+    stack<contiguous_stack> stack{};
+    stack.emplace_inline(expected);
+    BOOST_REQUIRE(stack.pop() == stack_variant{ expected });
+}
+
+BOOST_AUTO_TEST_CASE(stack__peek_slice__all_types__expected)
+{
+    const auto pushed = data_chunk{ 0x42, 0x43 };
+    stack<contiguous_stack> stack{};
+    stack_chunk buffer{};
+
+    stack.push(true);
+    BOOST_REQUIRE(stack.peek_slice(buffer) == data_chunk{ 0x01 });
+    stack.push(-42);
+    BOOST_REQUIRE(stack.peek_slice(buffer) == data_chunk{ 0xaa });
+    stack.emplace_chunk(chunk_xptr{ pushed });
+    BOOST_REQUIRE(stack.peek_slice(buffer) == pushed);
+    stack.emplace_inline(stack_chunk{ data_array<2>{ 0x42, 0x43 } });
+    BOOST_REQUIRE(stack.peek_slice(buffer) == pushed);
+    BOOST_REQUIRE_EQUAL(stack.peek_size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(stack__equal_chunks__inline_and_pointer__expected)
+{
+    using stack_type = stack<contiguous_stack>;
+    const auto pushed = data_chunk{ 0x01 };
+    const stack_variant inlined{ stack_chunk{ data_array<1>{ 0x01 } } };
+    BOOST_REQUIRE(stack_type::equal_chunks(inlined, stack_variant{ chunk_xptr{ pushed } }));
+    BOOST_REQUIRE(stack_type::equal_chunks(stack_variant{ chunk_xptr{ pushed } }, inlined));
+    BOOST_REQUIRE(stack_type::equal_chunks(inlined, stack_variant{ true }));
+    BOOST_REQUIRE(stack_type::equal_chunks(stack_variant{ int64_t{ 1 } }, inlined));
+    BOOST_REQUIRE(stack_type::equal_chunks(inlined, inlined));
+    BOOST_REQUIRE(!stack_type::equal_chunks(inlined, stack_variant{ false }));
+    BOOST_REQUIRE(!stack_type::equal_chunks(inlined, stack_variant{ stack_chunk{} }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace system::machine;
+
+BOOST_AUTO_TEST_SUITE(stack_arena_tests)
+
+BOOST_AUTO_TEST_CASE(stack_arena__get__same_thread__same_instance)
+{
+    BOOST_REQUIRE(stack_arena::get() == stack_arena::get());
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__get__other_thread__distinct_instance)
+{
+    stack_arena* other{};
+    std::thread thread([&]() NOEXCEPT { other = stack_arena::get(); });
+    thread.join();
+    BOOST_REQUIRE(other != stack_arena::get());
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__start__reset__zero_detach)
+{
+    const auto arena = stack_arena::get();
+    arena->start(zero);
+    BOOST_REQUIRE_EQUAL(arena->detach(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__allocate__sequential__contiguous_aligned)
+{
+    const auto arena = stack_arena::get();
+    const auto first = pointer_cast<uint8_t>(arena->start(zero));
+    const auto one = pointer_cast<uint8_t>(arena->allocate(1, 1));
+    const auto two = pointer_cast<uint8_t>(arena->allocate(8, 8));
+    BOOST_REQUIRE(one == first);
+    BOOST_REQUIRE(two == std::next(first, 8));
+    BOOST_REQUIRE_EQUAL(arena->detach(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__start__after_allocate__returns_first)
+{
+    const auto arena = stack_arena::get();
+    const auto first = arena->start(zero);
+    arena->deallocate(arena->allocate(42), 42);
+    BOOST_REQUIRE(arena->start(zero) == first);
+    BOOST_REQUIRE(arena->allocate(42) == first);
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__allocate__overflow__outside_buffer)
+{
+    const auto arena = stack_arena::get();
+    const auto first = pointer_cast<uint8_t>(arena->start(zero));
+    const auto size = add1(stack_arena::capacity);
+    const auto memory = pointer_cast<uint8_t>(arena->allocate(size));
+    BOOST_REQUIRE(memory != nullptr);
+    BOOST_REQUIRE(memory < first || memory >= std::next(first, stack_arena::capacity));
+    BOOST_REQUIRE_EQUAL(arena->detach(), zero);
+    arena->deallocate(memory, size);
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__is_equal__self_and_default__expected)
+{
+    const auto arena = stack_arena::get();
+    BOOST_REQUIRE(arena->is_equal(*arena));
+    BOOST_REQUIRE(!arena->is_equal(*default_arena::get()));
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__stack_allocator__default__stack_arena)
+{
+    BOOST_REQUIRE(stack_allocator<stack_variant>{}.resource() == stack_arena::get());
+}
+
+BOOST_AUTO_TEST_CASE(stack_arena__arena_stack__copy__stack_arena)
+{
+    stack_arena::get()->start(zero);
+    arena_stack stack{ stack_variant{ true }, stack_variant{ 42 } };
+    const auto copy = stack;
+    BOOST_REQUIRE(copy.get_allocator().resource() == stack_arena::get());
+    BOOST_REQUIRE(copy == stack);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
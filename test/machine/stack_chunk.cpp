@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace system::machine;
+
+BOOST_AUTO_TEST_SUITE(stack_chunk_tests)
+
+using namespace number;
+
+static_assert(stack_chunk::capacity == 33u);
+static_assert(stack_chunk{}.empty());
+static_assert(is_zero(stack_chunk{}.size()));
+static_assert(stack_chunk{ short_hash{} }.size() == short_hash_size);
+static_assert(stack_chunk{ hash_digest{} }.size() == hash_size);
+static_assert(stack_chunk{ ec_compressed{} }.size() == ec_compressed_size);
+
+BOOST_AUTO_TEST_CASE(stack_chunk__construct__hash__expected)
+{
+    const auto hash = sha256_hash(data_chunk{ 0x42 });
+    const stack_chunk instance{ hash };
+    BOOST_REQUIRE_EQUAL(instance.size(), hash_size);
+    BOOST_REQUIRE_EQUAL(instance.to_chunk(), to_chunk(hash));
+    BOOST_REQUIRE(instance.slice() == hash);
+}
+
+BOOST_AUTO_TEST_CASE(stack_chunk__equality__same_and_different__expected)
+{
+    const stack_chunk left{ short_hash{ 0x42 } };
+    BOOST_REQUIRE(left == stack_chunk{ short_hash{ 0x42 } });
+    BOOST_REQUIRE(!(left == stack_chunk{ short_hash{ 0x43 } }));
+    BOOST_REQUIRE(!(left == stack_chunk{ hash_digest{ 0x42 } }));
+}
+
+BOOST_AUTO_TEST_CASE(stack_chunk__from_bool__always__chunk_from_bool)
+{
+    BOOST_REQUIRE_EQUAL(stack_chunk::from_bool(false).to_chunk(), chunk::from_bool(false));
+    BOOST_REQUIRE_EQUAL(stack_chunk::from_bool(true).to_chunk(), chunk::from_bool(true));
+}
+
+BOOST_AUTO_TEST_CASE(stack_chunk__from_integer__boundaries__chunk_from_integer)
+{
+    constexpr std::array<int64_t, 26> values
+    {
+        0, 1, -1, 16, -16, 127, -127, 128, -128, 255, -255, 256, -256,
+        32767, -32768, 32768, 65535, -65535,
+        max_int32, min_int32, add1<int64_t>(max_int32), sub1<int64_t>(min_int32),
+        max_int64, add1(min_int64), 0x0000ff0000000000, -0x0000ff0000000000
+    };
+
+    for (const auto value: values)
+    {
+        BOOST_REQUIRE_EQUAL(stack_chunk::from_integer(value).to_chunk(), chunk::from_integer(value));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(standard_tests)
+
+using namespace system::chain;
+using namespace system::machine;
+
+namespace {
+
+using stack = contiguous_stack;
+constexpr auto rules = flags::bip16_rule | flags::bip66_rule |
+    flags::bip141_rule | flags::bip143_rule | flags::bip341_rule |
+    flags::bip342_rule;
+constexpr uint64_t value = 42u;
+const auto secret = base16_hash("b7e151628aed2a6abf7158809cf4f3c762e7160f38b4da56a784d9045190cfef");
+
+// Exposes the program (unoptimized) connect, to which verify is compared.
+class accessor
+  : public interpreter<stack>
+{
+public:
+    using interpreter<stack>::connect_program;
+};
+
+context to_context(uint32_t active_flags) NOEXCEPT
+{
+    context state{};
+    state.flags = active_flags;
+    return state;
+}
+
+bool verify(const transaction& tx, uint32_t active_flags=rules) NOEXCEPT
+{
+    return standard::verify(to_context(active_flags), tx,
+        tx.inputs_ptr()->begin());
+}
+
+code connect(const transaction& tx, uint32_t active_flags=rules) NOEXCEPT
+{
+    return accessor::connect_program(to_context(active_flags), tx,
+        tx.inputs_ptr()->begin(), {});
+}
+
+// Verification succeeds if and only if program connection succeeds.
+bool is_equivalent(const transaction& tx, uint32_t active_flags=rules) NOEXCEPT
+{
+    return verify(tx, active_flags) ==
+        (connect(tx, active_flags) == error::script_success);
+}
+
+// Single input spend, with its prevout populated.
+transaction to_spend(const script& input_script, const chain::witness& witness,
+    const script& prevout) NOEXCEPT
+{
+    const point outpoint{ one_hash, 0u };
+    const chain::inputs ins{ input{ outpoint, input_script, witness, 0xffffffff } };
+    const chain::outputs outs{ output{ value, script{} } };
+    const transaction tx{ 1u, ins, outs, 0u };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(value, prevout);
+    return tx;
+}
+
+data_chunk to_key() NOEXCEPT
+{
+    ec_compressed point{};
+    secret_to_public(point, secret);
+    return { point.begin(), point.end() };
+}
+
+hash_digest to_xonly_key() NOEXCEPT
+{
+    const auto key = to_key();
+    return unsafe_array_cast<uint8_t, ec_xonly_size>(std::next(key.data()));
+}
+
+// p2pkh
+
+const script pay_key_hash{ script::to_pay_key_hash_pattern(bitcoin_short_hash(to_key())) };
+
+transaction to_pay_key_hash_spend(const endorsement& endorse) NOEXCEPT
+{
+    const script sign{ { { endorse, false }, { to_key(), false } } };
+    return to_spend(sign, {}, pay_key_hash);
+}
+
+endorsement to_pay_key_hash_endorsement() NOEXCEPT
+{
+    endorsement out{};
+    const auto tx = to_spend({}, {}, pay_key_hash);
+    tx.create_endorsement(out, secret, pay_key_hash, 0, value,
+        coverage::hash_all, script_version::unversioned, rules);
+    return out;
+}
+
+// p2wpkh
+
+const script pay_witness_key_hash{ script::to_pay_witness_key_hash_pattern(bitcoin_short_hash(to_key())) };
+
+transaction to_pay_witness_key_hash_spend(const endorsement& endorse) NOEXCEPT
+{
+    return to_spend({}, data_stack{ endorse, to_key() }, pay_witness_key_hash);
+}
+
+endorsement to_pay_witness_key_hash_endorsement() NOEXCEPT
+{
+    endorsement out{};
+    const auto tx = to_spend({}, {}, pay_witness_key_hash);
+    tx.create_endorsement(out, secret, pay_key_hash, 0, value,
+        coverage::hash_all, script_version::segwit, rules);
+    return out;
+}
+
+// p2tr (key path)
+
+const script pay_taproot{ script::to_pay_witness_taproot_pattern(to_xonly_key()) };
+
+transaction to_pay_taproot_spend(const endorsement& endorse,
+    const data_stack& annex={}) NOEXCEPT
+{
+    data_stack stack{ endorse };
+    stack.insert(stack.end(), annex.begin(), annex.end());
+    return to_spend({}, stack, pay_taproot);
+}
+
+endorsement to_pay_taproot_endorsement(uint8_t sighash_flags,
+    const data_stack& annex={}) NOEXCEPT
+{
+    // The signature hash does not cover the witness, apart from the annex.
+    const data_chunk dummy(ec_signature_size, 0x00);
+    const auto tx = to_pay_taproot_spend(dummy, annex);
+    const script checksig{ { { opcode::checksig } } };
+
+    hash_digest hash{};
+    ec_signature signature{};
+    tx.signature_hash(hash, tx.inputs_ptr()->begin(), checksig, value, {},
+        script_version::taproot, sighash_flags, rules);
+    schnorr::sign(signature, secret, hash, one_hash);
+
+    endorsement out{ signature.begin(), signature.end() };
+    if (sighash_flags != coverage::hash_default)
+        out.push_back(sighash_flags);
+
+    return out;
+}
+
+// Each single bit mutation of the endorsement must be treated equivalently.
+bool is_equivalent_mutations(const endorsement& endorse,
+    transaction(*to_spend)(const endorsement&)) NOEXCEPT
+{
+    auto success = true;
+    for (size_t byte{}; byte < endorse.size(); ++byte)
+    {
+        for (uint8_t bit{}; bit < byte_bits; ++bit)
+        {
+            auto mutant = endorse;
+            mutant.at(byte) ^= shift_left<uint8_t>(1u, bit);
+            success &= is_equivalent(to_spend(mutant));
+        }
+    }
+
+    return success;
+}
+
+transaction to_pay_taproot_default_spend(const endorsement& endorse) NOEXCEPT
+{
+    return to_pay_taproot_spend(endorse);
+}
+
+} // namespace
+
+// p2pkh
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_key_hash__valid__true)
+{
+    const auto tx = to_pay_key_hash_spend(to_pay_key_hash_endorsement());
+    const auto state = to_context(rules);
+    const auto it = tx.inputs_ptr()->begin();
+    BOOST_REQUIRE(standard::verify_pay_key_hash(state, tx, it));
+    BOOST_REQUIRE(!standard::verify_pay_witness_key_hash(state, tx, it));
+    BOOST_REQUIRE(!standard::verify_pay_taproot_key_path(state, tx, it));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(interpreter<stack>::connect(state, tx, 0), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_key_hash__mutated_endorsement__equivalent)
+{
+    BOOST_REQUIRE(is_equivalent_mutations(to_pay_key_hash_endorsement(), &to_pay_key_hash_spend));
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_key_hash__empty_endorsement__stack_false)
+{
+    const auto tx = to_pay_key_hash_spend({});
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_key_hash__witness__unexpected_witness)
+{
+    const script sign{ { { to_pay_key_hash_endorsement(), false }, { to_key(), false } } };
+    const auto tx = to_spend(sign, data_stack{ { 0x42 } }, pay_key_hash);
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::unexpected_witness);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_key_hash__other_key__equivalent)
+{
+    const script sign{ { { to_pay_key_hash_endorsement(), false }, { base16_chunk("02ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"), false } } };
+    const auto tx = to_spend(sign, {}, pay_key_hash);
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE(is_equivalent(tx));
+}
+
+// p2wpkh
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_witness_key_hash__valid__true)
+{
+    const auto tx = to_pay_witness_key_hash_spend(to_pay_witness_key_hash_endorsement());
+    const auto state = to_context(rules);
+    const auto it = tx.inputs_ptr()->begin();
+    BOOST_REQUIRE(standard::verify_pay_witness_key_hash(state, tx, it));
+    BOOST_REQUIRE(!standard::verify_pay_key_hash(state, tx, it));
+    BOOST_REQUIRE(!standard::verify_pay_taproot_key_path(state, tx, it));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(interpreter<stack>::connect(state, tx, 0), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_witness_key_hash__mutated_endorsement__equivalent)
+{
+    BOOST_REQUIRE(is_equivalent_mutations(to_pay_witness_key_hash_endorsement(), &to_pay_witness_key_hash_spend));
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_witness_key_hash__input_script__dirty_witness)
+{
+    const data_stack stack{ to_pay_witness_key_hash_endorsement(), to_key() };
+    const auto tx = to_spend(script{ { opcode::nop } }, stack, pay_witness_key_hash);
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::dirty_witness);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_witness_key_hash__extra_element__invalid_witness)
+{
+    const data_stack stack{ { 0x42 }, to_pay_witness_key_hash_endorsement(), to_key() };
+    const auto tx = to_spend({}, stack, pay_witness_key_hash);
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::invalid_witness);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_witness_key_hash__bip141_inactive__false)
+{
+    const auto tx = to_pay_witness_key_hash_spend(to_pay_witness_key_hash_endorsement());
+    BOOST_REQUIRE(!verify(tx, flags::bip16_rule));
+    BOOST_REQUIRE_EQUAL(connect(tx, flags::bip16_rule), error::unexpected_witness);
+}
+
+// p2tr
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_taproot_key_path__valid__true)
+{
+    const auto tx = to_pay_taproot_spend(to_pay_taproot_endorsement(coverage::hash_default));
+    const auto state = to_context(rules);
+    const auto it = tx.inputs_ptr()->begin();
+    BOOST_REQUIRE(standard::verify_pay_taproot_key_path(state, tx, it));
+    BOOST_REQUIRE(!standard::verify_pay_key_hash(state, tx, it));
+    BOOST_REQUIRE(!standard::verify_pay_witness_key_hash(state, tx, it));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(interpreter<stack>::connect(state, tx, 0), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_taproot_key_path__explicit_sighash__true)
+{
+    const auto tx = to_pay_taproot_spend(to_pay_taproot_endorsement(coverage::hash_all));
+    BOOST_REQUIRE(verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_taproot_key_path__mutated_endorsement__equivalent)
+{
+    const auto endorse = to_pay_taproot_endorsement(coverage::hash_default);
+    BOOST_REQUIRE(is_equivalent_mutations(endorse, &to_pay_taproot_default_spend));
+}
+
+BOOST_AUTO_TEST_CASE(standard__verify_pay_taproot_key_path__undefined_sighash__op_check_sig_schnorr1)
+{
+    auto endorse = to_pay_taproot_endorsement(coverage::hash_default);
+    endorse.push_back(0x04);
+    const auto tx = to_pay_taproot_spend(endorse);
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::op_check_sig_schnorr1);
+}
+
+// An annex is not verified here, but remains valid by program.
+BOOST_AUTO_TEST_CASE(standard__verify_pay_taproot_key_path__annex__false)
+{
+    const data_stack annex{ { taproot_annex_prefix, 0x42 } };
+    const auto tx = to_pay_taproot_spend(to_pay_taproot_endorsement(coverage::hash_default, annex), annex);
+    BOOST_REQUIRE(!verify(tx));
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+}
+
+// Without bip341 version 1 programs are unencumbered, but not verified here.
+BOOST_AUTO_TEST_CASE(standard__verify_pay_taproot_key_path__bip341_inactive__false)
+{
+    constexpr auto segwit = flags::bip16_rule | flags::bip141_rule | flags::bip143_rule;
+    const auto tx = to_pay_taproot_spend({ 0x42 });
+    BOOST_REQUIRE(!verify(tx, segwit));
+    BOOST_REQUIRE_EQUAL(connect(tx, segwit), error::script_success);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+#include "mocks/blocks.hpp"
+
+BOOST_AUTO_TEST_SUITE(monotonic_arena_tests)
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__get__same_thread__same_instance)
+{
+    BOOST_REQUIRE(monotonic_arena::get() == monotonic_arena::get());
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__get__other_thread__distinct_instance)
+{
+    monotonic_arena* other{};
+    std::thread thread([&]() NOEXCEPT { other = monotonic_arena::get(); });
+    thread.join();
+    BOOST_REQUIRE(other != monotonic_arena::get());
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__construct__default__empty)
+{
+    const monotonic_arena arena{};
+    const auto statistics = arena.get_statistics();
+    BOOST_REQUIRE_EQUAL(statistics.allocated, zero);
+    BOOST_REQUIRE_EQUAL(statistics.reserved, zero);
+    BOOST_REQUIRE_EQUAL(statistics.high_water, zero);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__sequential__contiguous_aligned)
+{
+    monotonic_arena arena{};
+    BOOST_REQUIRE(arena.start(zero) != nullptr);
+    const auto one = pointer_cast<uint8_t>(arena.allocate(1, 1));
+    const auto two = pointer_cast<uint8_t>(arena.allocate(8, 8));
+    BOOST_REQUIRE(two == std::next(one, 8));
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().allocated, 16u);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().reserved,
+        monotonic_arena::default_slab_size);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__without_start__allocated)
+{
+    monotonic_arena arena{};
+    BOOST_REQUIRE(arena.allocate(42) != nullptr);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().allocated, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__exceeds_slab__additional_slab)
+{
+    monotonic_arena arena{ monotonic_arena::page_size };
+    arena.start(zero);
+    BOOST_REQUIRE(arena.allocate(monotonic_arena::page_size / 2u) != nullptr);
+    BOOST_REQUIRE(arena.allocate(monotonic_arena::page_size / 2u) != nullptr);
+    BOOST_REQUIRE(arena.allocate(3u * monotonic_arena::page_size) != nullptr);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().allocated,
+        4u * monotonic_arena::page_size);
+    BOOST_REQUIRE_GT(arena.get_statistics().reserved,
+        5u * monotonic_arena::page_size);
+}
+
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__over_aligned_across_slabs__aligned)
+{
+    constexpr auto page = monotonic_arena::page_size;
+    monotonic_arena arena{ page };
+    arena.start(zero);
+    BOOST_REQUIRE(arena.allocate(page - 32u) != nullptr);
+
+    // Each of these exceeds the remainder of the current slab.
+    const auto cache = arena.allocate(page / 2u, 64);
+    const auto paged = arena.allocate(page, page);
+    const auto large = arena.allocate(page + 64u, 64);
+    BOOST_REQUIRE(is_zero(reinterpret_cast<uintptr_t>(cache) % 64u));
+    BOOST_REQUIRE(is_zero(reinterpret_cast<uintptr_t>(paged) % page));
+    BOOST_REQUIRE(is_zero(reinterpret_cast<uintptr_t>(large) % 64u));
+
+    // Allocations are writable over their full extent.
+    std::fill_n(pointer_cast<uint8_t>(cache), page / 2u, 0x01);
+    std::fill_n(pointer_cast<uint8_t>(paged), page, 0x02);
+    std::fill_n(pointer_cast<uint8_t>(large), page + 64u, 0x03);
+    BOOST_REQUIRE_EQUAL(pointer_cast<uint8_t>(cache)[sub1(page / 2u)], 0x01);
+    BOOST_REQUIRE_EQUAL(pointer_cast<uint8_t>(paged)[sub1(page)], 0x02);
+}
+
+BC_POP_WARNING()
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__start__sufficient__retains_first_slab)
+{
+    monotonic_arena arena{};
+    const auto first = arena.start(zero);
+    BOOST_REQUIRE(arena.allocate(2u * monotonic_arena::default_slab_size) != nullptr);
+    BOOST_REQUIRE(arena.start(42) == first);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().allocated, zero);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().reserved,
+        monotonic_arena::default_slab_size);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__start__high_water__retained)
+{
+    monotonic_arena arena{};
+    arena.start(zero);
+    BOOST_REQUIRE(arena.allocate(100) != nullptr);
+    arena.start(zero);
+    BOOST_REQUIRE(arena.allocate(42) != nullptr);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().allocated, 42u);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().high_water, 100u);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__start__huge_pages__huge_slab)
+{
+    monotonic_arena arena{ zero, true };
+    arena.start(zero);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().reserved,
+        monotonic_arena::huge_page_size);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__detach__allocated__size_relinquished)
+{
+    monotonic_arena arena{};
+    const auto address = arena.start(zero);
+    const auto memory = pointer_cast<uint8_t>(arena.allocate(42));
+    std::fill_n(memory, 42, 0x42);
+    BOOST_REQUIRE_EQUAL(arena.detach(), 42u);
+    BOOST_REQUIRE_EQUAL(arena.get_statistics().reserved, zero);
+
+    // Detached memory remains valid until released, start allocates anew.
+    BOOST_REQUIRE(arena.start(zero) != address);
+    BOOST_REQUIRE_EQUAL(memory[41], 0x42);
+    arena.release(address);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__is_equal__self_and_default__expected)
+{
+    const monotonic_arena arena{};
+    BOOST_REQUIRE(arena.is_equal(arena));
+    BOOST_REQUIRE(!arena.is_equal(*default_arena::get()));
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__block__detach_release__expected)
+{
+    const auto data = test::mock_block_b.to_data(true);
+    monotonic_arena arena{};
+    const auto address = arena.start(data.size());
+    stream::in::fast stream(data);
+    read::bytes::fast source(stream, &arena);
+    auto instance = std::make_unique<const chain::block>(source, true);
+    BOOST_REQUIRE(!is_zero(arena.detach()));
+
+    // The block outlives arena reuse, and is freed by its owner.
+    arena.start(zero);
+    BOOST_REQUIRE(*instance == test::mock_block_b);
+    instance.reset();
+    arena.release(address);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
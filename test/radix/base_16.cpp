@@ -602,4 +602,76 @@ BOOST_AUTO_TEST_CASE(base16__base16_hash__one_hash__expected)
     BOOST_REQUIRE_EQUAL(base16_hash("0000000000000000000000000000000000000000000000000000000000000001"), expected);
 }
 
+// encode_base16/encode_hash/decode_base16/decode_hash (runtime)
+
+// Covers whole 32 and 16 byte blocks and every tail size.
+constexpr size_t runtime_sizes = 100;
+
+std::string reference_base16(const data_chunk& data, bool reversed)
+{
+    constexpr char digits[] = "0123456789abcdef";
+    std::string out;
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        const auto octet = data[reversed ? data.size() - index - 1u : index];
+        out.push_back(digits[octet >> 4]);
+        out.push_back(digits[octet & 0x0f]);
+    }
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(base16__encode_base16__runtime_sizes__expected)
+{
+    for (size_t size = 0; size <= runtime_sizes; ++size)
+    {
+        data_chunk data(size);
+        for (size_t index = 0; index < size; ++index)
+            data[index] = static_cast<uint8_t>(index * 37u + 11u);
+
+        const auto expected = reference_base16(data, false);
+        BOOST_REQUIRE_EQUAL(encode_base16(data), expected);
+        BOOST_REQUIRE_EQUAL(encode_hash(data), reference_base16(data, true));
+
+        data_chunk decoded;
+        BOOST_REQUIRE(decode_base16(decoded, expected));
+        BOOST_REQUIRE_EQUAL(decoded, data);
+        BOOST_REQUIRE(decode_base16(decoded, ascii_to_upper(expected)));
+        BOOST_REQUIRE_EQUAL(decoded, data);
+
+        data_chunk reversed(size);
+        BOOST_REQUIRE(decode_hash(reversed.data(), reference_base16(data, true).data(), size));
+        BOOST_REQUIRE_EQUAL(reversed, data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16__runtime_invalid_character__false)
+{
+    // Each invalid character is rejected at every position.
+    constexpr char invalid[] = { '/', ':', '@', 'G', '`', 'g', '\x00', '\xb0', '\xe1' };
+    const std::string valid(2u * runtime_sizes, 'a');
+    for (size_t position = 0; position < valid.size(); ++position)
+    {
+        for (const auto character: invalid)
+        {
+            auto text = valid;
+            text[position] = character;
+            data_chunk out;
+            BOOST_REQUIRE(!decode_base16(out, text));
+            BOOST_REQUIRE(out.empty());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16__runtime_all_octets__expected)
+{
+    data_chunk data(256);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index);
+
+    data_chunk decoded;
+    BOOST_REQUIRE(decode_base16(decoded, encode_base16(data)));
+    BOOST_REQUIRE_EQUAL(decoded, data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
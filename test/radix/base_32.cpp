@@ -235,4 +235,72 @@ BOOST_AUTO_TEST_CASE(base_32__base32_pack__vector5__expected)
     BOOST_REQUIRE_EQUAL(base32_pack(unpacked), expected);
 }
 
+// base32_pack/base32_unpack (symbol bytes)
+
+BOOST_AUTO_TEST_CASE(base_32__base32_unpack_symbols__bit_reader_equivalence__expected)
+{
+    // Covers whole 40 bit groups and every partial group size.
+    for (size_t size = 0; size <= 64; ++size)
+    {
+        data_chunk packed(size);
+        for (size_t index = 0; index < size; ++index)
+            packed[index] = static_cast<uint8_t>(index * 73u + 41u);
+
+        data_chunk expected;
+        read::bits::copy source(packed);
+        while (!source.is_exhausted())
+            expected.push_back(static_cast<uint8_t>(source.read_bits(5)));
+
+        data_chunk unpacked;
+        base32_unpack(unpacked, packed);
+        BOOST_REQUIRE_EQUAL(unpacked, expected);
+
+        data_chunk repacked;
+        BOOST_REQUIRE(base32_pack(repacked, unpacked));
+        BOOST_REQUIRE_EQUAL(repacked, packed);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base_32__base32_pack_symbols__nonzero_padding__false_cleared)
+{
+    // [11111][111x1]=> padding bit set.
+    data_chunk out{ 0x42 };
+    BOOST_REQUIRE(!base32_pack(out, data_chunk{ 0x1f, 0x1d }));
+    BOOST_REQUIRE(out.empty());
+    BOOST_REQUIRE_EQUAL(base32_pack(base32_chunk{ 0x1f, 0x1d }), data_chunk{});
+}
+
+BOOST_AUTO_TEST_CASE(base_32__base32_pack_symbols__vector2__expected)
+{
+    data_chunk out;
+    BOOST_REQUIRE(base32_pack(out, data_chunk{ 0x1f, 0x1f, 0x1f, 0x10 }));
+    BOOST_REQUIRE_EQUAL(out, data_chunk(2, 0xff));
+}
+
+// encode_base32_symbols/decode_base32_symbols
+
+BOOST_AUTO_TEST_CASE(base_32__encode_base32_symbols__all_symbols__appended)
+{
+    data_chunk symbols(32);
+    for (size_t index = 0; index < symbols.size(); ++index)
+        symbols[index] = static_cast<uint8_t>(index);
+
+    std::string out{ "bc1" };
+    encode_base32_symbols(out, symbols);
+    BOOST_REQUIRE_EQUAL(out, "bc1qpzry9x8gf2tvdw0s3jn54khce6mua7l");
+
+    data_chunk decoded;
+    BOOST_REQUIRE(decode_base32_symbols(decoded, out.substr(3)));
+    BOOST_REQUIRE_EQUAL(decoded, symbols);
+}
+
+BOOST_AUTO_TEST_CASE(base_32__decode_base32_symbols__invalid__false)
+{
+    data_chunk out;
+    BOOST_REQUIRE(decode_base32_symbols(out, "QPZRY"));
+    BOOST_REQUIRE_EQUAL(out, (data_chunk{ 0, 1, 2, 3, 4 }));
+    BOOST_REQUIRE(!decode_base32_symbols(out, "qpzRY"));
+    BOOST_REQUIRE(!decode_base32_symbols(out, "qpzrb"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
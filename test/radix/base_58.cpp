@@ -29,6 +29,47 @@ void encode_decode_test(const std::string& base16, const std::string& encoded)
     BOOST_REQUIRE(decoded == data);
 }
 
+// Bytewise reference encoder, for limb conversion equivalence.
+std::string reference_encode(const data_chunk& data)
+{
+    const std::string digits = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    size_t zeros = 0;
+    while (zeros < data.size() && is_zero(data[zeros]))
+        ++zeros;
+
+    data_chunk indexes(add1((data.size() - zeros) * 138 / 100), 0x00);
+    for (auto it = std::next(data.begin(), zeros); it != data.end(); ++it)
+    {
+        size_t carry = *it;
+        for (auto index = indexes.rbegin(); index != indexes.rend(); ++index)
+        {
+            carry += 256u * (*index);
+            *index = static_cast<uint8_t>(carry % 58u);
+            carry /= 58u;
+        }
+    }
+
+    auto it = indexes.begin();
+    while (it != indexes.end() && is_zero(*it))
+        ++it;
+
+    std::string out(zeros, '1');
+    for (; it != indexes.end(); ++it)
+        out += digits[*it];
+
+    return out;
+}
+
+// Deterministic data of the given size, prefixed with the given zero count.
+data_chunk sample(size_t size, size_t zeros)
+{
+    data_chunk out(size, 0x00);
+    for (auto index = zeros; index < size; ++index)
+        out[index] = static_cast<uint8_t>(index * 167u + size * 13u + 1u);
+
+    return out;
+}
+
 // is_base58
 
 BOOST_AUTO_TEST_CASE(base58__is_base58__valid__true)
@@ -108,4 +149,90 @@ BOOST_AUTO_TEST_CASE(base58__decode_base58__array__expected)
     BOOST_REQUIRE_EQUAL(converted, expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58__encode_base58__reference_equivalence__expected)
+{
+    // Covers partial limb groups, stack (<= 82 bytes) and heap scratch.
+    for (size_t size = 0; size <= 200; ++size)
+    {
+        for (const auto zeros: { 0_size, 1_size, 5_size })
+        {
+            const auto data = sample(size, std::min(zeros, size));
+            const auto encoded = encode_base58(data);
+            BOOST_REQUIRE_EQUAL(encoded, reference_encode(data));
+
+            data_chunk decoded;
+            BOOST_REQUIRE(decode_base58(decoded, encoded));
+            BOOST_REQUIRE_EQUAL(decoded, data);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__extended_key_size__round_trip)
+{
+    const auto data = sample(82, 0);
+    const auto encoded = encode_base58(data);
+    BOOST_REQUIRE_EQUAL(encoded, reference_encode(data));
+
+    data_array<82> decoded;
+    BOOST_REQUIRE(decode_base58(decoded, encoded));
+    BOOST_REQUIRE_EQUAL(to_chunk(decoded), data);
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__all_ones__zeros)
+{
+    data_chunk decoded;
+    BOOST_REQUIRE(decode_base58(decoded, "111"));
+    BOOST_REQUIRE_EQUAL(decoded, data_chunk(3, 0x00));
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__invalid_character__false_cleared)
+{
+    data_chunk decoded{ 0x42 };
+    BOOST_REQUIRE(!decode_base58(decoded, "19TbMSWwHvnxAKy12iNm3Kdb0fzfaMFViT"));
+    BOOST_REQUIRE(decoded.empty());
+    BOOST_REQUIRE(!decode_base58(decoded, "1l"));
+    BOOST_REQUIRE(!decode_base58(decoded, std::string{ "2g\0", 3 }));
+}
+
+// encode_base58_many / decode_base58_many
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58_many__empty__empty)
+{
+    BOOST_REQUIRE(encode_base58_many({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58_many__round_trip__expected)
+{
+    const data_stack data
+    {
+        sample(25, 1),
+        sample(0, 0),
+        sample(200, 3),
+        sample(82, 0),
+        sample(4, 4)
+    };
+
+    const auto encoded = encode_base58_many(data);
+    BOOST_REQUIRE_EQUAL(encoded.size(), data.size());
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(encoded[index], encode_base58(data[index]));
+    }
+
+    data_stack decoded;
+    BOOST_REQUIRE(decode_base58_many(decoded, encoded));
+    BOOST_REQUIRE_EQUAL(decoded.size(), data.size());
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(decoded[index], data[index]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58_many__invalid_element__false_cleared)
+{
+    data_stack decoded;
+    BOOST_REQUIRE(!decode_base58_many(decoded, { "2g", "a3gV", "0" }));
+    BOOST_REQUIRE(decoded.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -110,4 +110,25 @@ BOOST_AUTO_TEST_CASE(hex_reader__istream_stream__genesis_block__expected)
     BOOST_REQUIRE(block == genesis());
 }
 
+BOOST_AUTO_TEST_CASE(hex_reader__read_bytes__multiple_blocks__expected)
+{
+    data_chunk data(1000);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 7u);
+
+    const auto text = encode_base16(data);
+    read::base16::copy reader{ text };
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(data.size()), data);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(hex_reader__read_bytes__invalid_in_second_block__invalid)
+{
+    auto text = encode_base16(data_chunk(1000, 0x42));
+    text[700] = 'x';
+    read::base16::copy reader{ text };
+    reader.read_bytes(1000);
+    BOOST_REQUIRE(!reader);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
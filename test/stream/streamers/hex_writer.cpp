@@ -97,4 +97,18 @@ BOOST_AUTO_TEST_CASE(hex_writer__data__genesis_bheader__expected)
     BOOST_REQUIRE_EQUAL(to_string(hex), expected_base16());
 }
 
+BOOST_AUTO_TEST_CASE(hex_writer__write_bytes__multiple_blocks__expected)
+{
+    data_chunk data(1000);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 7u);
+
+    std::string text{};
+    write::base16::text hexer{ text };
+    hexer.write_bytes(data);
+    hexer.flush();
+    BOOST_REQUIRE(hexer);
+    BOOST_REQUIRE_EQUAL(text, encode_base16(data));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
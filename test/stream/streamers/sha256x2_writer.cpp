@@ -48,6 +48,22 @@ BOOST_AUTO_TEST_CASE(sha256x2_writer__fast__genesis_block__expected)
     BOOST_REQUIRE_EQUAL(hash, genesis().hash());
 }
 
+BOOST_AUTO_TEST_CASE(sha256x2_writer__fast__accumulated_prefix__expected)
+{
+    const auto data = genesis().header().to_data();
+    const auto split = std::next(data.begin(), 68);
+    accumulator<sha256> context{};
+    context.write(68, data.data());
+
+    hash_digest hash{};
+    stream::out::fast stream{ hash };
+    hash::sha256x2::fast hasher(stream, context);
+    hasher.write_bytes(data_chunk{ split, data.end() });
+    hasher.flush();
+    BOOST_REQUIRE(hasher);
+    BOOST_REQUIRE_EQUAL(hash, genesis().hash());
+}
+
 BOOST_AUTO_TEST_CASE(sha256x2_writer__copy__genesis_block__expected)
 {
     hash_digest hash;
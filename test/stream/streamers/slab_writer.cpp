@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stream_tests)
+
+BOOST_AUTO_TEST_CASE(slab_writer__write__integrals_and_bytes__expected)
+{
+    data_chunk data(2 + 4 + 8 + 2 + 3 + 1);
+    write::bytes::slab sink(data);
+    sink.write_2_bytes_little_endian(0x0201);
+    sink.write_4_bytes_little_endian(0x04030201);
+    sink.write_8_bytes_little_endian(0x0807060504030201);
+    sink.write_2_bytes_big_endian(0x0102);
+    sink.write_bytes(base16_chunk("aabbcc"));
+    sink.write_byte(0xdd);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE_EQUAL(sink.get_write_position(), data.size());
+    BOOST_REQUIRE_EQUAL(data, base16_chunk("0102" "01020304" "0102030405060708" "0102" "aabbcc" "dd"));
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_variable__all_widths__same_as_byte_writer)
+{
+    constexpr std::array<uint64_t, 8> values
+    {
+        0, 0xfc, 0xfd, 0xffff, 0x10000, 0xffffffff, 0x100000000, max_uint64
+    };
+
+    for (const auto value: values)
+    {
+        data_chunk expected(variable_size(value));
+        stream::out::fast stream(expected);
+        write::bytes::fast fast(stream);
+        fast.write_variable(value);
+        fast.flush();
+
+        data_chunk data(variable_size(value));
+        write::bytes::slab sink(data);
+        sink.write_variable(value);
+        BOOST_REQUIRE(sink);
+        BOOST_REQUIRE_EQUAL(data, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write__overflow__invalid_unwritten)
+{
+    data_chunk data(3, 0xff);
+    write::bytes::slab sink(data);
+    sink.write_byte(0x00);
+    sink.write_4_bytes_little_endian(0);
+    BOOST_REQUIRE(!sink);
+    sink.write_byte(0x00);
+    BOOST_REQUIRE_EQUAL(sink.get_write_position(), one);
+    BOOST_REQUIRE_EQUAL(data, base16_chunk("00ffff"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
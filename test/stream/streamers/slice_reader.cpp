@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stream_tests)
+
+BOOST_AUTO_TEST_CASE(slice_reader__construct__empty__exhausted_valid)
+{
+    const data_chunk data{};
+    read::bytes::slice source(data);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), zero);
+    BOOST_REQUIRE_EQUAL(source.get_allocator().resource(), test::get_default_resource());
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_integrals__little_and_big_endian__expected)
+{
+    const auto data = base16_chunk("0102" "01020304" "0102030405060708" "0102" "01020304");
+    read::bytes::slice source(data);
+    BOOST_REQUIRE_EQUAL(source.read_2_bytes_little_endian(), 0x0201u);
+    BOOST_REQUIRE_EQUAL(source.read_4_bytes_little_endian(), 0x04030201u);
+    BOOST_REQUIRE_EQUAL(source.read_8_bytes_little_endian(), 0x0807060504030201u);
+    BOOST_REQUIRE_EQUAL(source.read_2_bytes_big_endian(), 0x0102u);
+    BOOST_REQUIRE_EQUAL((source.read_big_endian<uint32_t, 3>()), 0x010203u);
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x04u);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_variable__all_encodings__same_as_byte_reader)
+{
+    const std::vector<std::string> encodings
+    {
+        "00", "fc", "fdfd00", "fdffff", "fe00000100", "feffffffff",
+        "ff0000000001000000", "ffffffffffffffffff",
+
+        // non-minimal (invalid)
+        "fd0000", "fdfc00", "feffff0000", "ffffffffff00000000",
+
+        // truncated (invalid)
+        "", "fd", "fdff", "feffffff", "ffffffffffffffff"
+    };
+
+    for (const auto& encoding: encodings)
+    {
+        data_chunk data{};
+        BOOST_REQUIRE(decode_base16(data, encoding));
+        stream::in::fast stream(data);
+        read::bytes::fast expected(stream);
+        read::bytes::slice source(data);
+        const auto value = source.read_variable();
+        const auto expected_value = expected.read_variable();
+        BOOST_REQUIRE_EQUAL(!source, !expected);
+
+        // Values read from an invalidated reader are undefined.
+        if (source)
+        {
+            BOOST_REQUIRE_EQUAL(value, expected_value);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_size__exceeds_limit__zero_invalid)
+{
+    const auto data = base16_chunk("fd0001");
+    read::bytes::slice source(data);
+    BOOST_REQUIRE_EQUAL(source.read_size(0xff), zero);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_hash__overflow__null_hash_invalid_position_retained)
+{
+    const auto data = base16_chunk("00112233");
+    read::bytes::slice source(data);
+    source.skip_byte();
+    BOOST_REQUIRE_EQUAL(source.read_hash(), null_hash);
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), one);
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x00u);
+    BOOST_REQUIRE(source.read_bytes(one).empty());
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_slice__in_place__expected)
+{
+    const auto data = base16_chunk("03001122");
+    read::bytes::slice source(data);
+    const auto slice = source.read_slice(source.read_size());
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE_EQUAL(slice.size(), 3u);
+    BOOST_REQUIRE_EQUAL(slice.data(), std::next(data.data()));
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(source.read_slice(one).empty());
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__skip_rewind__within_and_beyond__expected)
+{
+    const auto data = base16_chunk("0011223344");
+    read::bytes::slice source(data);
+    source.skip_bytes(4);
+    BOOST_REQUIRE_EQUAL(source.peek_byte(), 0x44u);
+    source.rewind_bytes(2);
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x22u);
+    BOOST_REQUIRE_EQUAL(source.read_bytes(2), base16_chunk("3344"));
+    BOOST_REQUIRE(source);
+    source.rewind_bytes(6);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes_cptr__sized_and_remaining__expected)
+{
+    const auto data = base16_chunk("0011223344");
+    read::bytes::slice source(data);
+    const auto sized = source.read_bytes_cptr(2);
+    BOOST_REQUIRE(sized);
+    BOOST_REQUIRE_EQUAL(*sized, base16_chunk("0011"));
+    const auto remaining = source.read_bytes_cptr();
+    BOOST_REQUIRE(remaining);
+    BOOST_REQUIRE_EQUAL(*remaining, base16_chunk("223344"));
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(!source.read_bytes_cptr(one));
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_limit__limited_and_unlimited__expected)
+{
+    const auto data = base16_chunk("0011223344");
+    read::bytes::slice source(data);
+    source.skip_byte();
+    source.set_limit(2);
+    BOOST_REQUIRE_EQUAL(source.read_bytes(2), base16_chunk("1122"));
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(source);
+    source.set_limit();
+    BOOST_REQUIRE(!source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(source.read_bytes(2), base16_chunk("3344"));
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_position__after_overflow__valid_within_limit)
+{
+    const auto data = base16_chunk("0011223344");
+    read::bytes::slice source(data);
+    source.set_limit(3);
+    source.skip_byte();
+    BOOST_REQUIRE_EQUAL(source.read_hash(), null_hash);
+    BOOST_REQUIRE(!source);
+    source.set_position(one);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE_EQUAL(*source.read_bytes_cptr(), base16_chunk("1122"));
+    source.set_position(4);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__chain_block__genesis__same_as_fast_reader)
+{
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    read::bytes::slice source(data);
+    const chain::block instance(source, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(instance == genesis);
+    BOOST_REQUIRE(chain::block(data, true) == genesis);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__block_view__genesis__same_as_fast_reader)
+{
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    const chain::block_view view(data_chunk{ data }, true);
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.hash(), genesis.hash());
+
+    stream::in::fast stream(data);
+    read::bytes::fast fast(stream);
+    read::bytes::slice slice(data);
+    fast.skip_bytes(chain::header::serialized_size());
+    slice.skip_bytes(chain::header::serialized_size());
+    BOOST_REQUIRE_EQUAL(slice.read_size(), fast.read_size());
+
+    const chain::transaction_view expected(fast, data, true, true);
+    const chain::transaction_view tx(slice, data, true, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), expected.hash(false));
+    BOOST_REQUIRE_EQUAL(slice.get_read_position(), fast.get_read_position());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
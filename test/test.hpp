@@ -55,14 +55,14 @@ namespace std {
 std::ostream& operator<<(std::ostream& stream,
     const data_slice& slice) NOEXCEPT;
 
-// std::vector<Type> -> join(<<Type)
-template <typename Type>
+// std::vector<Type, Allocator> -> join(<<Type)
+template <typename Type, typename Allocator>
 std::ostream& operator<<(std::ostream& stream,
-    const std::vector<Type>& values) NOEXCEPT
+    const std::vector<Type, Allocator>& values) NOEXCEPT
 {
     // Ok when testing serialize because only used for error message out.
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream << serialize(values);
+    stream << serialize(std_vector<Type>{ values.begin(), values.end() });
     BC_POP_WARNING()
     return stream;
 }